@@ -13,6 +13,7 @@
 using namespace tinyply;
 
 #include "example-utils.hpp"
+#include <filesystem>
 
 void write_ply_example(const std::string & filename)
 {
@@ -51,36 +52,19 @@ void write_ply_example(const std::string & filename)
     cube_file.write(outstream_binary, true);
 }
 
-void read_ply_file(const std::string & filepath, const bool preload_into_memory = true)
+void read_ply_file(const std::string & filepath)
 {
     std::cout << "........................................................................\n";
     std::cout << "Now Reading: " << filepath << std::endl;
 
-    std::unique_ptr<std::istream> file_stream;
-    std::vector<uint8_t> byte_buffer;
-
     try
     {
-        // For most files < 1gb, preloading the entire file upfront into memory and wrapping it into a 
-        // stream is a net win for parsing speed (~30-40% faster)
-        if (preload_into_memory)
-        {
-            byte_buffer = read_file_binary(filepath);
-            file_stream.reset(new memory_stream((char*)byte_buffer.data(), byte_buffer.size()));
-        }
-        else
-        {
-            file_stream.reset(new std::ifstream(filepath, std::ios::binary));
-        }
-
-        if (!file_stream || file_stream->fail()) throw std::runtime_error("file_stream failed to open " + filepath);
-
-        file_stream->seekg(0, std::ios::end);
-        const float size_mb = file_stream->tellg() * float(1e-6);
-        file_stream->seekg(0, std::ios::beg);
+        const float size_mb = std::filesystem::file_size(filepath) * float(1e-6);
 
+        // Memory-mapping the file is the fastest way to read it: tinyply parses the header and payload
+        // straight out of the mapped region, without preloading it into a buffer or going through an istream.
         PlyFile file;
-        file.parse_header(*file_stream);
+        if (!file.parse_header_file(filepath)) throw std::runtime_error("failed to parse header of " + filepath);
 
         std::cout << "\t[ply_header] Type: " << (file.is_binary_file() ? "binary" : "ascii") << std::endl;
         for (const auto & c : file.get_comments()) std::cout << "\t[ply_header] Comment: " << c << std::endl;
@@ -122,19 +106,22 @@ void read_ply_file(const std::string & filepath, const bool preload_into_memory
         catch (const std::exception & e) { std::cerr << "tinyply exception: " << e.what() << std::endl; }
 
         // >>> Important Performance Optimization <<<
-        // Providing a list size hint (the last argument) is a 2x performance improvement. If you have 
-        // arbitrary in-the-wild user-imported ply files, set this argument to 0. 
+        // Providing a list size hint (the last argument) allocates the faces up front instead of growing
+        // the buffer while parsing. If you have arbitrary in-the-wild user-imported ply files, set this argument to 0. 
         try { faces = file.request_properties_from_element("face", { "vertex_indices" }, 3); }
         catch (const std::exception & e) { std::cerr << "tinyply exception: " << e.what() << std::endl; }
 
-        // Tristrips must always be read with a list size hint set to 0
-        try { tristrip = file.request_properties_from_element("tristrips", { "vertex_indices" }, 0); }
+        // Tristrips must always be read with a list size hint set to 0. They are unrolled into a triangle list
+        // while reading, so `tristrip` can be drawn like any other triangle buffer.
+        RequestOptions strip_options;
+        strip_options.tristrips = true;
+        try { tristrip = file.request_properties_from_element("tristrips", { "vertex_indices" }, 0, strip_options); }
         catch (const std::exception & e) { std::cerr << "tinyply exception: " << e.what() << std::endl; }
 
         manual_timer read_timer;
 
         read_timer.start();
-        file.read(*file_stream);
+        file.read_file(filepath);
         read_timer.stop();
 
         const float parsing_time = static_cast<float>(read_timer.get()) / 1000.f;
@@ -145,7 +132,7 @@ void read_ply_file(const std::string & filepath, const bool preload_into_memory
         if (colors)     std::cout << "\tRead " << colors->count << " total vertex colors " << std::endl;
         if (texcoords)  std::cout << "\tRead " << texcoords->count << " total vertex texcoords " << std::endl;
         if (faces)      std::cout << "\tRead " << faces->count     << " total faces (triangles) " << std::endl;
-        if (tristrip)   std::cout << "\tRead " << (tristrip->buffer.size_bytes() / tinyply::PropertyTable[tristrip->t].stride) << " total indices (tristrip) " << std::endl;
+        if (tristrip)   std::cout << "\tRead " << tristrip->count << " total triangles (tristrip) " << std::endl;
         if (faces->list_sizes.size()) std::cout << "\tRead " << faces->list_sizes.size() << " varible-length indices " << std::endl;
 
         // Example one: converting to your own application types
@@ -268,7 +255,7 @@ int main(int argc, char *argv[])
     // Circular write-read
     write_ply_example("example_cube");
     read_ply_file("example_cube-ascii.ply");
-    read_ply_file("example_cube-binary.ply", true);
+    read_ply_file("example_cube-binary.ply");
 
     return EXIT_SUCCESS;
 }
@@ -14,6 +14,7 @@
 using namespace tinyply;
 
 #include "example-utils.hpp"
+#include <cstdio>
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
@@ -241,6 +242,26 @@ void parse_and_verify_transcode(const std::string & filepath)
     parse_ply_file(transcoded_path, false);
 }
 
+// Writes the example cube (positions + triangle indices) as a ply file
+void write_cube_ply(std::ostream & outstream, const geometry & cube, bool binary)
+{
+    PlyFile file;
+    file.add_properties_to_element("vertex", { "x", "y", "z" },
+        Type::FLOAT32, cube.vertices.size(), reinterpret_cast<const uint8_t*>(cube.vertices.data()), Type::INVALID, 0);
+    file.add_properties_to_element("face", { "vertex_indices" },
+        Type::UINT32, cube.triangles.size(), reinterpret_cast<const uint8_t*>(cube.triangles.data()), Type::UINT8, 3);
+    file.write(outstream, binary);
+}
+
+void write_cube_ply(const std::string & filepath, const geometry & cube, bool binary)
+{
+    std::filebuf fb;
+    fb.open(filepath, binary ? (std::ios::out | std::ios::binary) : std::ios::out);
+    std::ostream outstream(&fb);
+    REQUIRE_FALSE(outstream.fail());
+    write_cube_ply(outstream, cube, binary);
+}
+
 ///////////////////////////
 //   Conformance Tests   //
 ///////////////////////////
@@ -655,4 +676,1314 @@ TEST_CASE("payload.unaligned-memory.ply")
 TEST_CASE("payload.unexpected-eof.ply")
 {
     CHECK_THROWS(parse_ply_file("../assets/validate/invalid/payload.unexpected-eof.ply"));
-}
\ No newline at end of file
+}
+
+TEST_CASE("memory-mapped reads match the written data")
+{
+    const geometry cube = make_cube_geometry();
+
+    for (bool binary : { true, false })
+    {
+        const std::string filepath = binary ? "mmap-cube-binary.ply" : "mmap-cube-ascii.ply";
+        write_cube_ply(filepath, cube, binary);
+
+        PlyFile file;
+        REQUIRE(file.parse_header_file(filepath));
+        CHECK(file.is_binary_file() == binary);
+
+        auto vertices = file.request_properties_from_element("vertex", { "x", "y", "z" });
+        auto faces = file.request_properties_from_element("face", { "vertex_indices" }, 0);
+        file.read_file(filepath);
+
+        REQUIRE(vertices->buffer.size_bytes() == cube.vertices.size() * sizeof(float3));
+        CHECK(std::memcmp(vertices->buffer.get(), cube.vertices.data(), vertices->buffer.size_bytes()) == 0);
+        REQUIRE(faces->buffer.size_bytes() == cube.triangles.size() * sizeof(uint3));
+        CHECK(std::memcmp(faces->buffer.get(), cube.triangles.data(), faces->buffer.size_bytes()) == 0);
+    }
+    std::remove("mmap-cube-binary.ply");
+    std::remove("mmap-cube-ascii.ply");
+
+    PlyFile missing;
+    CHECK_THROWS(missing.parse_header_file("does-not-exist.ply"));
+}
+
+TEST_CASE("span-based reads match the written data")
+{
+    const geometry cube = make_cube_geometry();
+
+    for (bool binary : { true, false })
+    {
+        std::ostringstream os;
+        write_cube_ply(os, cube, binary);
+        const std::string bytes = os.str();
+        const uint8_t * data = reinterpret_cast<const uint8_t*>(bytes.data());
+
+        PlyFile file;
+        REQUIRE(file.parse_header(data, bytes.size()));
+
+        auto vertices = file.request_properties_from_element("vertex", { "x", "y", "z" });
+        auto faces = file.request_properties_from_element("face", { "vertex_indices" }, 0);
+        file.read(data, bytes.size());
+
+        REQUIRE(vertices->buffer.size_bytes() == cube.vertices.size() * sizeof(float3));
+        CHECK(std::memcmp(vertices->buffer.get(), cube.vertices.data(), vertices->buffer.size_bytes()) == 0);
+        REQUIRE(faces->buffer.size_bytes() == cube.triangles.size() * sizeof(uint3));
+        CHECK(std::memcmp(faces->buffer.get(), cube.triangles.data(), faces->buffer.size_bytes()) == 0);
+
+        // A truncated payload must be reported, not read past
+        if (binary)
+        {
+            PlyFile truncated;
+            REQUIRE(truncated.parse_header(data, bytes.size()));
+            truncated.request_properties_from_element("face", { "vertex_indices" }, 3);
+            CHECK_THROWS_AS(truncated.read(data, bytes.size() - 1), std::runtime_error);
+        }
+    }
+}
+
+TEST_CASE("zero-copy views alias the source rows")
+{
+    const geometry cube = make_cube_geometry();
+
+    std::ostringstream os;
+    {
+        PlyFile writer;
+        writer.add_properties_to_element("vertex", { "x", "y", "z" },
+            Type::FLOAT32, cube.vertices.size(), reinterpret_cast<const uint8_t*>(cube.vertices.data()), Type::INVALID, 0);
+        writer.add_properties_to_element("vertex", { "nx", "ny", "nz" },
+            Type::FLOAT32, cube.normals.size(), reinterpret_cast<const uint8_t*>(cube.normals.data()), Type::INVALID, 0);
+        writer.write(os, true);
+    }
+    const std::string bytes = os.str();
+    const uint8_t * data = reinterpret_cast<const uint8_t*>(bytes.data());
+
+    RequestOptions zero_copy;
+    zero_copy.zero_copy = true;
+
+    SUBCASE("span source")
+    {
+        PlyFile file;
+        REQUIRE(file.parse_header(data, bytes.size()));
+        auto vertices = file.request_properties_from_element("vertex", { "x", "y", "z" }, 0, zero_copy);
+        auto normals = file.request_properties_from_element("vertex", { "nx", "ny", "nz" });
+        file.read(data, bytes.size());
+
+        REQUIRE(vertices->stride == 6 * sizeof(float));
+        CHECK(vertices->buffer.get() >= data);
+        CHECK(vertices->buffer.get() + vertices->buffer.size_bytes() <= data + bytes.size());
+        CHECK(normals->stride == 0);
+        for (size_t i = 0; i < cube.vertices.size(); ++i)
+        {
+            CHECK(std::memcmp(vertices->buffer.get() + i * vertices->stride, &cube.vertices[i], sizeof(float3)) == 0);
+            CHECK(std::memcmp(normals->buffer.get() + i * sizeof(float3), &cube.normals[i], sizeof(float3)) == 0);
+        }
+    }
+
+    SUBCASE("views into a mapped file outlive the PlyFile")
+    {
+        std::ofstream("zero-copy-cube.ply", std::ios::binary).write(bytes.data(), bytes.size());
+        std::shared_ptr<PlyData> normals;
+        {
+            PlyFile file;
+            REQUIRE(file.parse_header_file("zero-copy-cube.ply"));
+            normals = file.request_properties_from_element("vertex", { "nx", "ny", "nz" }, 0, zero_copy);
+            file.read_file("zero-copy-cube.ply");
+        }
+        REQUIRE(normals->stride == 6 * sizeof(float));
+        for (size_t i = 0; i < cube.normals.size(); ++i)
+            CHECK(std::memcmp(normals->buffer.get() + i * normals->stride, &cube.normals[i], sizeof(float3)) == 0);
+        normals.reset(); // releases the mapping
+        std::remove("zero-copy-cube.ply");
+    }
+
+    SUBCASE("istream sources fall back to a copy")
+    {
+        std::istringstream is(bytes);
+        PlyFile file;
+        REQUIRE(file.parse_header(is));
+        auto vertices = file.request_properties_from_element("vertex", { "x", "y", "z" }, 0, zero_copy);
+        file.read(is);
+        CHECK(vertices->stride == 0);
+        REQUIRE(vertices->buffer.size_bytes() == cube.vertices.size() * sizeof(float3));
+        CHECK(std::memcmp(vertices->buffer.get(), cube.vertices.data(), vertices->buffer.size_bytes()) == 0);
+    }
+}
+
+TEST_CASE("a single group covering every property of a row is read in place")
+{
+    // A gaussian-splat style vertex: one wide row of floats, requested as a single group
+    const std::vector<std::string> keys = { "x", "y", "z", "opacity", "scale_0", "scale_1", "scale_2", "rot_0", "rot_1", "rot_2", "rot_3" };
+    const size_t num_vertices = 1000;
+    std::vector<float> values(num_vertices * keys.size());
+    for (size_t i = 0; i < values.size(); ++i) values[i] = static_cast<float>(i) * 0.25f;
+
+    std::ostringstream os;
+    PlyFile writer;
+    writer.add_properties_to_element("vertex", keys, Type::FLOAT32, num_vertices, reinterpret_cast<const uint8_t*>(values.data()), Type::INVALID, 0);
+    writer.write(os, true);
+    const std::string bytes = os.str();
+
+    std::istringstream is(bytes);
+    PlyFile file;
+    REQUIRE(file.parse_header(is));
+    auto splats = file.request_properties_from_element("vertex", keys);
+    file.read(is);
+
+    REQUIRE(splats->buffer.size_bytes() == values.size() * sizeof(float));
+    CHECK(std::memcmp(splats->buffer.get(), values.data(), splats->buffer.size_bytes()) == 0);
+}
+
+TEST_CASE("parallel scatter matches the written data")
+{
+    // Large enough (~12mb) to be split into several row ranges
+    const size_t num_vertices = 800000;
+    std::vector<float3> positions(num_vertices);
+    std::vector<uint8_t> colors(num_vertices * 3);
+    for (size_t i = 0; i < num_vertices; ++i)
+    {
+        positions[i] = { float(i), float(i) * 0.5f, -float(i) };
+        for (size_t c = 0; c < 3; ++c) colors[i * 3 + c] = static_cast<uint8_t>(i + c);
+    }
+
+    std::ostringstream os;
+    PlyFile writer;
+    writer.add_properties_to_element("vertex", { "x", "y", "z" }, Type::FLOAT32, num_vertices, reinterpret_cast<const uint8_t*>(positions.data()), Type::INVALID, 0);
+    writer.add_properties_to_element("vertex", { "red", "green", "blue" }, Type::UINT8, num_vertices, colors.data(), Type::INVALID, 0);
+    writer.write(os, true);
+    const std::string bytes = os.str();
+    const uint8_t * data = reinterpret_cast<const uint8_t*>(bytes.data());
+
+    auto read_with = [&](const ReadOptions & options)
+    {
+        PlyFile file;
+        REQUIRE(file.parse_header(data, bytes.size()));
+        file.get_read_options() = options;
+        auto xyz = file.request_properties_from_element("vertex", { "x", "y", "z" });
+        auto rgb = file.request_properties_from_element("vertex", { "red", "green", "blue" });
+        file.read(data, bytes.size());
+
+        REQUIRE(xyz->buffer.size_bytes() == num_vertices * sizeof(float3));
+        CHECK(std::memcmp(xyz->buffer.get(), positions.data(), xyz->buffer.size_bytes()) == 0);
+        REQUIRE(rgb->buffer.size_bytes() == colors.size());
+        CHECK(std::memcmp(rgb->buffer.get(), colors.data(), colors.size()) == 0);
+    };
+
+    ReadOptions threaded;
+    threaded.num_threads = 3;
+    read_with(threaded);
+
+    size_t executor_tasks = 0;
+    ReadOptions executor;
+    executor.num_threads = 3;
+    executor.executor = [&](size_t count, const std::function<void(size_t)> & job)
+    {
+        executor_tasks = count;
+        for (size_t i = 0; i < count; ++i) job(i);
+    };
+    read_with(executor);
+    CHECK(executor_tasks > 1);
+}
+
+TEST_CASE("projection reads gather only the requested columns of a wide element")
+{
+    // Gaussian-splat style row: x y z followed by many attributes, of which only a few are requested
+    const size_t num_vertices = 1000;
+    const size_t num_attributes = 59;
+    std::vector<float3> positions(num_vertices);
+    std::vector<float> attributes(num_vertices * num_attributes);
+    for (size_t i = 0; i < num_vertices; ++i)
+    {
+        positions[i] = { float(i), float(i) + 0.25f, float(i) + 0.5f };
+        for (size_t a = 0; a < num_attributes; ++a) attributes[i * num_attributes + a] = float(i * num_attributes + a);
+    }
+
+    std::vector<std::string> attribute_keys;
+    for (size_t a = 0; a < num_attributes; ++a) attribute_keys.push_back("f_" + std::to_string(a));
+
+    std::ostringstream os;
+    PlyFile writer;
+    writer.add_properties_to_element("vertex", { "x", "y", "z" }, Type::FLOAT32, num_vertices, reinterpret_cast<const uint8_t*>(positions.data()), Type::INVALID, 0);
+    writer.add_properties_to_element("vertex", attribute_keys, Type::FLOAT32, num_vertices, reinterpret_cast<const uint8_t*>(attributes.data()), Type::INVALID, 0);
+    writer.write(os, true);
+    const std::string bytes = os.str();
+
+    auto check = [&](PlyFile & file, const std::function<void(PlyFile &)> & read)
+    {
+        auto xyz = file.request_properties_from_element("vertex", { "x", "y", "z" });
+        auto picked = file.request_properties_from_element("vertex", { "f_3", "f_40" });
+        read(file);
+
+        REQUIRE(xyz->buffer.size_bytes() == num_vertices * sizeof(float3));
+        CHECK(std::memcmp(xyz->buffer.get(), positions.data(), xyz->buffer.size_bytes()) == 0);
+        REQUIRE(picked->count == num_vertices);
+        const float * p = reinterpret_cast<const float *>(picked->buffer.get());
+        for (size_t i = 0; i < num_vertices; ++i)
+        {
+            CHECK(p[i * 2 + 0] == attributes[i * num_attributes + 3]);
+            CHECK(p[i * 2 + 1] == attributes[i * num_attributes + 40]);
+        }
+    };
+
+    SUBCASE("istream")
+    {
+        std::istringstream is(bytes);
+        PlyFile file;
+        REQUIRE(file.parse_header(is));
+        check(file, [&](PlyFile & f) { f.read(is); });
+    }
+
+    SUBCASE("span")
+    {
+        const uint8_t * data = reinterpret_cast<const uint8_t*>(bytes.data());
+        PlyFile file;
+        REQUIRE(file.parse_header(data, bytes.size()));
+        check(file, [&](PlyFile & f) { f.read(data, bytes.size()); });
+    }
+}
+
+TEST_CASE("stream reads stage rows in bounded chunks")
+{
+    const size_t num_vertices = 5000;
+    std::vector<float3> positions(num_vertices);
+    std::vector<uint8_t> colors(num_vertices * 3);
+    for (size_t i = 0; i < num_vertices; ++i)
+    {
+        positions[i] = { float(i), -float(i), float(i) * 2.0f };
+        for (size_t c = 0; c < 3; ++c) colors[i * 3 + c] = static_cast<uint8_t>(i * 7 + c);
+    }
+
+    std::ostringstream os;
+    PlyFile writer;
+    writer.add_properties_to_element("vertex", { "x", "y", "z" }, Type::FLOAT32, num_vertices, reinterpret_cast<const uint8_t*>(positions.data()), Type::INVALID, 0);
+    writer.add_properties_to_element("vertex", { "red", "green", "blue" }, Type::UINT8, num_vertices, colors.data(), Type::INVALID, 0);
+    writer.write(os, true);
+
+    // Chunks of 1000 bytes do not divide the 15 byte rows, and the last chunk is partial
+    for (const size_t staging_bytes : { size_t(1), size_t(1000), size_t(1) << 20 })
+    {
+        std::istringstream is(os.str());
+        PlyFile file;
+        REQUIRE(file.parse_header(is));
+        file.get_read_options().staging_bytes = staging_bytes;
+        auto xyz = file.request_properties_from_element("vertex", { "x", "y", "z" });
+        auto blue = file.request_properties_from_element("vertex", { "blue" });
+        file.read(is);
+
+        REQUIRE(xyz->buffer.size_bytes() == num_vertices * sizeof(float3));
+        CHECK(std::memcmp(xyz->buffer.get(), positions.data(), xyz->buffer.size_bytes()) == 0);
+        REQUIRE(blue->count == num_vertices);
+        for (size_t i = 0; i < num_vertices; ++i) CHECK(blue->buffer.get()[i] == colors[i * 3 + 2]);
+    }
+}
+
+TEST_CASE("specialized and generic scatter kernels agree with the source rows")
+{
+    // A 5 byte column (generic kernel), a 3 byte column and a uchar-count triangle list (specialized kernels)
+    const size_t num_rows = 3000;
+    std::vector<uint8_t> five(num_rows * 5), three(num_rows * 3);
+    std::vector<uint32_t> tris(num_rows * 3);
+    for (size_t i = 0; i < five.size(); ++i) five[i] = static_cast<uint8_t>(i * 31);
+    for (size_t i = 0; i < three.size(); ++i) three[i] = static_cast<uint8_t>(i * 17);
+    for (size_t i = 0; i < tris.size(); ++i) tris[i] = static_cast<uint32_t>(i);
+
+    std::ostringstream os;
+    PlyFile writer;
+    writer.add_properties_to_element("row", { "a0", "a1", "a2", "a3", "a4" }, Type::UINT8, num_rows, five.data(), Type::INVALID, 0);
+    writer.add_properties_to_element("row", { "b0", "b1", "b2" }, Type::UINT8, num_rows, three.data(), Type::INVALID, 0);
+    writer.add_properties_to_element("row", { "vertex_indices" }, Type::UINT32, num_rows, reinterpret_cast<const uint8_t*>(tris.data()), Type::UINT8, 3);
+    writer.write(os, true);
+    const std::string bytes = os.str();
+    const uint8_t * data = reinterpret_cast<const uint8_t*>(bytes.data());
+
+    PlyFile file;
+    REQUIRE(file.parse_header(data, bytes.size()));
+    auto a = file.request_properties_from_element("row", { "a0", "a1", "a2", "a3", "a4" });
+    auto b = file.request_properties_from_element("row", { "b0", "b2" });
+    auto t = file.request_properties_from_element("row", { "vertex_indices" }, 3);
+    file.read(data, bytes.size());
+
+    CHECK(std::memcmp(a->buffer.get(), five.data(), five.size()) == 0);
+    CHECK(std::memcmp(t->buffer.get(), tris.data(), tris.size() * sizeof(uint32_t)) == 0);
+    for (size_t i = 0; i < num_rows; ++i)
+    {
+        CHECK(b->buffer.get()[i * 2 + 0] == three[i * 3 + 0]);
+        CHECK(b->buffer.get()[i * 2 + 1] == three[i * 3 + 2]);
+    }
+
+    // A wrong hint is still caught by the list kernel
+    PlyFile wrong;
+    REQUIRE(wrong.parse_header(data, bytes.size()));
+    wrong.request_properties_from_element("row", { "vertex_indices" }, 4);
+    CHECK_THROWS(wrong.read(data, bytes.size()));
+}
+
+TEST_CASE("properties requested one by one are de-interleaved into their own buffers")
+{
+    // 11 floats and 5 doubles per row so that full transposes, partial runs and a row tail all occur
+    const size_t num_rows = 1003;
+    const size_t num_floats = 11, num_doubles = 5;
+    std::vector<float> floats(num_rows * num_floats);
+    std::vector<double> doubles(num_rows * num_doubles);
+    for (size_t i = 0; i < floats.size(); ++i) floats[i] = float(i) * 0.5f;
+    for (size_t i = 0; i < doubles.size(); ++i) doubles[i] = double(i) * -0.25;
+
+    std::vector<std::string> float_keys, double_keys;
+    for (size_t k = 0; k < num_floats; ++k) float_keys.push_back("f_" + std::to_string(k));
+    for (size_t k = 0; k < num_doubles; ++k) double_keys.push_back("d_" + std::to_string(k));
+
+    std::ostringstream os;
+    PlyFile writer;
+    writer.add_properties_to_element("vertex", float_keys, Type::FLOAT32, num_rows, reinterpret_cast<const uint8_t*>(floats.data()), Type::INVALID, 0);
+    writer.add_properties_to_element("vertex", double_keys, Type::FLOAT64, num_rows, reinterpret_cast<const uint8_t*>(doubles.data()), Type::INVALID, 0);
+    writer.write(os, true);
+    const std::string bytes = os.str();
+    const uint8_t * data = reinterpret_cast<const uint8_t*>(bytes.data());
+
+    // Cached stores, then non-temporal stores for any destination size
+    for (const size_t non_temporal_bytes : { size_t(0), size_t(1) })
+    {
+        PlyFile file;
+        REQUIRE(file.parse_header(data, bytes.size()));
+        file.get_read_options().non_temporal_bytes = non_temporal_bytes;
+        std::vector<std::shared_ptr<PlyData>> float_data, double_data;
+        for (const auto & key : float_keys) float_data.push_back(file.request_properties_from_element("vertex", { key }));
+        for (const auto & key : double_keys) double_data.push_back(file.request_properties_from_element("vertex", { key }));
+        file.read(data, bytes.size());
+
+        for (size_t k = 0; k < num_floats; ++k)
+        {
+            const float * values = reinterpret_cast<const float *>(float_data[k]->buffer.get());
+            for (size_t i = 0; i < num_rows; ++i) REQUIRE(values[i] == floats[i * num_floats + k]);
+        }
+        for (size_t k = 0; k < num_doubles; ++k)
+        {
+            const double * values = reinterpret_cast<const double *>(double_data[k]->buffer.get());
+            for (size_t i = 0; i < num_rows; ++i) REQUIRE(values[i] == doubles[i * num_doubles + k]);
+        }
+    }
+}
+
+TEST_CASE("big-endian payloads are byte-swapped for every item width")
+{
+    // Enough rows that each buffer has full vector blocks and a scalar tail
+    const size_t num_rows = 37;
+    std::string payload;
+    auto put_be = [&](const void * value, size_t size)
+    {
+        const char * bytes = static_cast<const char *>(value);
+        for (size_t i = 0; i < size; ++i) payload.push_back(bytes[size - 1 - i]);
+    };
+
+    std::vector<int16_t> shorts(num_rows);
+    std::vector<uint32_t> uints(num_rows * 3);
+    std::vector<float> floats(num_rows);
+    std::vector<double> doubles(num_rows);
+    for (size_t i = 0; i < num_rows; ++i)
+    {
+        shorts[i] = static_cast<int16_t>(-1000 + int(i) * 77);
+        floats[i] = float(i) * 1.5f - 3.0f;
+        doubles[i] = double(i) * -1e9;
+        put_be(&shorts[i], 2);
+        put_be(&floats[i], 4);
+        put_be(&doubles[i], 8);
+        const uint8_t count = 3;
+        payload.push_back(static_cast<char>(count));
+        for (size_t k = 0; k < 3; ++k)
+        {
+            uints[i * 3 + k] = static_cast<uint32_t>(0x01020304u * (i + k));
+            put_be(&uints[i * 3 + k], 4);
+        }
+    }
+
+    // A second element of eight floats per row, read whole, in pairs of two-float groups, or one property at a time
+    std::vector<float> attributes(num_rows * 8);
+    for (size_t i = 0; i < attributes.size(); ++i)
+    {
+        attributes[i] = float(i) * 0.125f;
+        put_be(&attributes[i], 4);
+    }
+
+    const std::string bytes = "ply\nformat binary_big_endian 1.0\nelement vertex " + std::to_string(num_rows) +
+        "\nproperty short s\nproperty float f\nproperty double d\nproperty list uchar uint idx\n" +
+        "element attribute " + std::to_string(num_rows) +
+        "\nproperty float a0\nproperty float a1\nproperty float a2\nproperty float a3" +
+        "\nproperty float a4\nproperty float a5\nproperty float a6\nproperty float a7\nend_header\n" + payload;
+
+    const std::vector<std::string> attribute_keys = { "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7" };
+
+    // Without a hint the vertex rows are variable-length and parsed one by one; with it they are scattered in bulk
+    for (const uint32_t hint : { 0u, 3u })
+    {
+        for (const size_t group_size : { size_t(8), size_t(2), size_t(1) })
+        {
+            std::istringstream is(bytes);
+            PlyFile file;
+            REQUIRE(file.parse_header(is));
+            CHECK(file.is_big_endian());
+            auto s = file.request_properties_from_element("vertex", { "s" });
+            auto f = file.request_properties_from_element("vertex", { "f" });
+            auto d = file.request_properties_from_element("vertex", { "d" });
+            auto idx = file.request_properties_from_element("vertex", { "idx" }, hint);
+            std::vector<std::shared_ptr<PlyData>> attrs;
+            for (size_t k = 0; k < attribute_keys.size(); k += group_size)
+            {
+                const std::vector<std::string> group(attribute_keys.begin() + k, attribute_keys.begin() + k + group_size);
+                attrs.push_back(file.request_properties_from_element("attribute", group));
+            }
+            file.read(is);
+
+            CHECK(std::memcmp(s->buffer.get(), shorts.data(), shorts.size() * sizeof(int16_t)) == 0);
+            CHECK(std::memcmp(f->buffer.get(), floats.data(), floats.size() * sizeof(float)) == 0);
+            CHECK(std::memcmp(d->buffer.get(), doubles.data(), doubles.size() * sizeof(double)) == 0);
+            CHECK(std::memcmp(idx->buffer.get(), uints.data(), uints.size() * sizeof(uint32_t)) == 0);
+            for (size_t k = 0; k < attrs.size(); ++k)
+            {
+                const float * values = reinterpret_cast<const float *>(attrs[k]->buffer.get());
+                const size_t width = 8 / attrs.size();
+                for (size_t i = 0; i < num_rows; ++i)
+                    for (size_t j = 0; j < width; ++j) REQUIRE(values[i * width + j] == attributes[i * 8 + k * width + j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("big-endian triangle lists with wide counts are validated and swapped in bulk")
+{
+    const size_t num_faces = 500;
+    const auto make_file = [&](const char * count_type, size_t count_bytes, uint32_t count)
+    {
+        std::string bytes = std::string("ply\nformat binary_big_endian 1.0\nelement face ") + std::to_string(num_faces) +
+            "\nproperty list " + count_type + " int vertex_indices\nend_header\n";
+        for (size_t f = 0; f < num_faces; ++f)
+        {
+            for (size_t k = 0; k < count_bytes; ++k) bytes.push_back(static_cast<char>(count >> (8 * (count_bytes - 1 - k))));
+            for (uint32_t v = 0; v < 3; ++v)
+            {
+                const uint32_t index = static_cast<uint32_t>(f * 3 + v);
+                for (int k = 3; k >= 0; --k) bytes.push_back(static_cast<char>(index >> (8 * k)));
+            }
+        }
+        return bytes;
+    };
+
+    for (const auto & count_type : std::vector<std::pair<const char *, size_t>>{ { "uchar", 1 }, { "short", 2 }, { "uint", 4 } })
+    {
+        const std::string bytes = make_file(count_type.first, count_type.second, 3);
+        const uint8_t * data = reinterpret_cast<const uint8_t*>(bytes.data());
+
+        PlyFile file;
+        REQUIRE(file.parse_header(data, bytes.size()));
+        auto faces = file.request_properties_from_element("face", { "vertex_indices" }, 3);
+        file.read(data, bytes.size());
+
+        REQUIRE(faces->buffer.size_bytes() == num_faces * 3 * sizeof(int32_t));
+        const int32_t * indices = reinterpret_cast<const int32_t *>(faces->buffer.get());
+        for (size_t i = 0; i < num_faces * 3; ++i) REQUIRE(indices[i] == static_cast<int32_t>(i));
+
+        // Counts that disagree with the hint are reported with their decoded value
+        const std::string quads = make_file(count_type.first, count_type.second, 4);
+        PlyFile wrong;
+        REQUIRE(wrong.parse_header(reinterpret_cast<const uint8_t*>(quads.data()), quads.size()));
+        wrong.request_properties_from_element("face", { "vertex_indices" }, 3);
+        CHECK_THROWS_WITH(wrong.read(reinterpret_cast<const uint8_t*>(quads.data()), quads.size()),
+            "list_size_hint mismatch: hint=3, actual=4. Use list_size_hint=0 for variable-length lists.");
+    }
+}
+
+TEST_CASE("variable-length lists are read in a single pass from non-seekable streams")
+{
+    // A forward-only stream buffer, like a pipe or a decompressor: any seek fails
+    struct forward_only_buf : std::streambuf
+    {
+        std::string bytes;
+        size_t pos{ 0 };
+        char current;
+        explicit forward_only_buf(const std::string & bytes) : bytes(bytes) {}
+        int_type underflow() override
+        {
+            if (pos >= bytes.size()) return traits_type::eof();
+            current = bytes[pos++];
+            setg(&current, &current, &current + 1);
+            return traits_type::to_int_type(current);
+        }
+    };
+
+    const size_t num_faces = 20000;
+    std::vector<size_t> sizes;
+    std::vector<uint32_t> indices;
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+        sizes.push_back(3 + (f * 7919) % 4);
+        for (size_t k = 0; k < sizes.back(); ++k) indices.push_back(static_cast<uint32_t>(f * 11 + k));
+    }
+
+    for (const bool binary : { false, true })
+    {
+        std::ostringstream os;
+        os << "ply\nformat " << (binary ? "binary_little_endian" : "ascii") << " 1.0\nelement face " << num_faces
+            << "\nproperty list uchar uint vertex_indices\nproperty uchar flags\nend_header\n";
+        for (size_t f = 0, i = 0; f < num_faces; i += sizes[f], ++f)
+        {
+            const uint8_t count = static_cast<uint8_t>(sizes[f]);
+            if (binary)
+            {
+                os.write(reinterpret_cast<const char *>(&count), 1);
+                os.write(reinterpret_cast<const char *>(&indices[i]), count * sizeof(uint32_t));
+                os.put(static_cast<char>(f));
+            }
+            else
+            {
+                os << int(count);
+                for (size_t k = 0; k < count; ++k) os << " " << indices[i + k];
+                os << " " << (f & 0xff) << "\n";
+            }
+        }
+
+        for (const bool presize_lists : { false, true })
+        {
+            forward_only_buf buf(os.str());
+            std::istream is(&buf);
+            std::istringstream seekable(os.str());
+            std::istream & source = presize_lists ? static_cast<std::istream &>(seekable) : is;
+
+            PlyFile file;
+            REQUIRE(file.parse_header(source));
+            file.get_read_options().presize_lists = presize_lists;
+            auto faces = file.request_properties_from_element("face", { "vertex_indices" });
+            auto flags = file.request_properties_from_element("face", { "flags" });
+            file.read(source);
+
+            REQUIRE(faces->buffer.size_bytes() == indices.size() * sizeof(uint32_t));
+            CHECK(std::memcmp(faces->buffer.get(), indices.data(), faces->buffer.size_bytes()) == 0);
+            CHECK(faces->list_sizes == sizes);
+            REQUIRE(flags->count == num_faces);
+            CHECK(flags->buffer.get()[num_faces - 1] == static_cast<uint8_t>(num_faces - 1));
+        }
+    }
+}
+
+TEST_CASE("auto-sized lists fall back to variable-length at the first row that disagrees")
+{
+    const size_t num_faces = 10000;
+    for (const size_t quad_row : { size_t(0), size_t(100), size_t(7000), num_faces })
+    {
+        std::vector<size_t> sizes(num_faces, 3);
+        if (quad_row < num_faces) sizes[quad_row] = 4;
+        std::vector<uint32_t> indices;
+        for (size_t f = 0; f < num_faces; ++f)
+            for (size_t k = 0; k < sizes[f]; ++k) indices.push_back(static_cast<uint32_t>(f * 5 + k));
+
+        for (const bool binary : { false, true })
+        {
+            std::ostringstream os;
+            os << "ply\nformat " << (binary ? "binary_little_endian" : "ascii") << " 1.0\nelement face " << num_faces
+                << "\nproperty list uchar uint vertex_indices\nproperty float quality\nend_header\n";
+            for (size_t f = 0, i = 0; f < num_faces; i += sizes[f], ++f)
+            {
+                const uint8_t count = static_cast<uint8_t>(sizes[f]);
+                const float quality = float(f);
+                if (binary)
+                {
+                    os.write(reinterpret_cast<const char *>(&count), 1);
+                    os.write(reinterpret_cast<const char *>(&indices[i]), count * sizeof(uint32_t));
+                    os.write(reinterpret_cast<const char *>(&quality), sizeof(float));
+                }
+                else
+                {
+                    os << int(count);
+                    for (size_t k = 0; k < count; ++k) os << " " << indices[i + k];
+                    os << " " << quality << "\n";
+                }
+            }
+            const std::string bytes = os.str();
+
+            // In-memory binary elements are bulk-read up to the quad; streams count rows on the row-by-row path
+            for (const bool span : { false, true })
+            {
+                std::istringstream is(bytes);
+                PlyFile file;
+                if (span) REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()));
+                else REQUIRE(file.parse_header(is));
+                auto faces = file.request_properties_from_element("face", { "vertex_indices" }, auto_list_size_hint);
+                auto quality = file.request_properties_from_element("face", { "quality" });
+                if (span) file.read(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+                else file.read(is);
+
+                REQUIRE(faces->buffer.size_bytes() == indices.size() * sizeof(uint32_t));
+                CHECK(std::memcmp(faces->buffer.get(), indices.data(), faces->buffer.size_bytes()) == 0);
+                CHECK(reinterpret_cast<const float *>(quality->buffer.get())[num_faces - 1] == float(num_faces - 1));
+                if (quad_row < num_faces)
+                {
+                    CHECK(faces->list_sizes == sizes);
+                    CHECK(faces->list_size_histogram == std::map<size_t, size_t>{ { 3, num_faces - 1 }, { 4, 1 } });
+                }
+                else
+                {
+                    CHECK(faces->list_sizes.empty());
+                    CHECK(faces->list_size_histogram == std::map<size_t, size_t>{ { 3, num_faces } });
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("variable-length lists can be described by narrow prefix-sum offsets")
+{
+    // Totals of 240, 2500 and 100000 indices need 8, 16 and 32 bit offsets respectively
+    const std::vector<std::pair<size_t, Type>> cases = { { 60, Type::UINT8 }, { 625, Type::UINT16 }, { 25000, Type::UINT32 } };
+    for (const auto & test : cases)
+    {
+        const size_t num_faces = test.first;
+        std::vector<size_t> sizes;
+        std::vector<uint32_t> indices;
+        std::string payload;
+        for (size_t f = 0; f < num_faces; ++f)
+        {
+            sizes.push_back(f % 2 ? 5 : 3);
+            payload.push_back(static_cast<char>(sizes.back()));
+            for (size_t k = 0; k < sizes.back(); ++k)
+            {
+                indices.push_back(static_cast<uint32_t>(indices.size()));
+                payload.append(reinterpret_cast<const char *>(&indices.back()), sizeof(uint32_t));
+            }
+        }
+        const std::string bytes = "ply\nformat binary_little_endian 1.0\nelement face " + std::to_string(num_faces) +
+            "\nproperty list uchar uint vertex_indices\nend_header\n" + payload;
+
+        for (const uint32_t hint : { 0u, auto_list_size_hint })
+        {
+            for (const bool presize_lists : { false, true })
+            {
+                PlyFile file;
+                REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()));
+                file.get_read_options().presize_lists = presize_lists;
+                RequestOptions options;
+                options.list_offsets = true;
+                auto faces = file.request_properties_from_element("face", { "vertex_indices" }, hint, options);
+                file.read(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+
+                CHECK(faces->list_sizes.empty());
+                REQUIRE(faces->list_offsets_type == test.second);
+                REQUIRE(faces->list_offsets.size_bytes() == (num_faces + 1) * PropertyTable[test.second].stride);
+                REQUIRE(faces->list_offset(num_faces) == indices.size());
+                const uint32_t * values = reinterpret_cast<const uint32_t *>(faces->buffer.get());
+                for (size_t f = 0; f < num_faces; ++f)
+                {
+                    REQUIRE(faces->list_offset(f + 1) - faces->list_offset(f) == sizes[f]);
+                    CHECK(values[faces->list_offset(f)] == faces->list_offset(f));
+                }
+
+                // Written back, every row keeps its own list count
+                std::ostringstream binary;
+                file.write(binary, true);
+                const std::string written = binary.str();
+                CHECK(written.substr(written.find("end_header\n") + 11) == payload);
+
+                std::stringstream ascii;
+                file.write(ascii, false);
+                PlyFile reread;
+                REQUIRE(reread.parse_header(ascii));
+                auto reread_faces = reread.request_properties_from_element("face", { "vertex_indices" });
+                reread.read(ascii);
+                CHECK(reread_faces->list_sizes == sizes);
+            }
+        }
+    }
+}
+
+TEST_CASE("face lists are fan-triangulated while they are read")
+{
+    const size_t num_faces = 3000;
+    for (const bool mixed : { true, false })
+    {
+        // Mixed polygons, degenerate lists included, or nothing but quads
+        std::vector<std::vector<int32_t>> faces(num_faces);
+        for (size_t f = 0; f < num_faces; ++f)
+        {
+            const size_t n = mixed ? (f * 7) % 9 : 4;
+            for (size_t k = 0; k < n; ++k) faces[f].push_back(static_cast<int32_t>(f * 10 + k));
+        }
+
+        std::vector<int32_t> expected;
+        std::vector<uint32_t> expected_faces;
+        for (size_t f = 0; f < num_faces; ++f)
+        {
+            for (size_t t = 1; t + 1 < faces[f].size(); ++t)
+            {
+                expected.insert(expected.end(), { faces[f][0], faces[f][t], faces[f][t + 1] });
+                expected_faces.push_back(static_cast<uint32_t>(f));
+            }
+        }
+
+        for (const std::string format : { "ascii", "binary_little_endian", "binary_big_endian" })
+        {
+            std::ostringstream os;
+            os << "ply\nformat " << format << " 1.0\nelement face " << num_faces << "\nproperty list uchar int vertex_indices\nproperty uchar flags\nend_header\n";
+            for (const auto & face : faces)
+            {
+                if (format == "ascii")
+                {
+                    os << face.size();
+                    for (const int32_t v : face) os << " " << v;
+                    os << " 1\n";
+                    continue;
+                }
+                os.put(static_cast<char>(face.size()));
+                for (const int32_t v : face)
+                {
+                    for (size_t k = 0; k < 4; ++k) os.put(static_cast<char>(v >> (8 * (format == "binary_big_endian" ? 3 - k : k))));
+                }
+                os.put(1);
+            }
+            const std::string bytes = os.str();
+
+            for (const uint32_t hint : { 0u, 4u, auto_list_size_hint })
+            {
+                if (hint == 4 && mixed) continue;
+
+                PlyFile file;
+                REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()));
+                RequestOptions options;
+                options.triangulate = true;
+                options.face_map = true;
+                auto triangles = file.request_properties_from_element("face", { "vertex_indices" }, hint, options);
+                auto flags = file.request_properties_from_element("face", { "flags" });
+                file.read(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+
+                REQUIRE(triangles->count == expected.size() / 3);
+                REQUIRE(triangles->buffer.size_bytes() == expected.size() * sizeof(int32_t));
+                CHECK(std::memcmp(triangles->buffer.get(), expected.data(), triangles->buffer.size_bytes()) == 0);
+                CHECK(triangles->list_sizes.empty());
+                CHECK(triangles->triangle_faces == expected_faces);
+                REQUIRE(flags->count == num_faces);
+                CHECK(flags->buffer.get()[num_faces - 1] == 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("triangle strips are unrolled into triangle lists while they are read")
+{
+    // A strip with a restart, a stitched strip with degenerate joins, and rows too short for a triangle
+    const std::vector<std::vector<int32_t>> rows = { { 0, 1, 2, 3, -1, 4, 5, 6 }, { 7, 8, 9, 9, 10, 10, 11, 12 }, { 1, 2 }, { -1 } };
+    const std::vector<int32_t> row_triangles = { 0, 1, 2, 2, 1, 3, 4, 5, 6, 7, 8, 9, 11, 10, 12 };
+    const std::vector<uint32_t> row_faces = { 0, 0, 0, 1, 1 };
+    const size_t repeats = 500;
+
+    for (const std::string type : { "int", "ushort" })
+    {
+        const size_t stride = type == "int" ? 4 : 2;
+        std::vector<uint8_t> expected;
+        std::vector<uint32_t> expected_faces;
+        for (size_t r = 0; r < repeats; ++r)
+        {
+            for (const int32_t v : row_triangles) expected.insert(expected.end(), reinterpret_cast<const uint8_t*>(&v), reinterpret_cast<const uint8_t*>(&v) + stride);
+            for (const uint32_t f : row_faces) expected_faces.push_back(static_cast<uint32_t>(r * rows.size() + f));
+        }
+
+        for (const std::string format : { "ascii", "binary_little_endian", "binary_big_endian" })
+        {
+            std::ostringstream os;
+            os << "ply\nformat " << format << " 1.0\nelement tristrips " << repeats * rows.size() << "\nproperty list int " << type << " vertex_indices\nend_header\n";
+            for (size_t r = 0; r < repeats; ++r)
+            {
+                for (const auto & row : rows)
+                {
+                    if (format == "ascii")
+                    {
+                        os << row.size();
+                        for (const int32_t v : row) os << " " << (stride == 2 ? static_cast<uint16_t>(v) : v);
+                        os << "\n";
+                        continue;
+                    }
+                    const bool big = format == "binary_big_endian";
+                    const uint32_t n = static_cast<uint32_t>(row.size());
+                    for (size_t k = 0; k < 4; ++k) os.put(static_cast<char>(n >> (8 * (big ? 3 - k : k))));
+                    for (const int32_t v : row)
+                    {
+                        for (size_t k = 0; k < stride; ++k) os.put(static_cast<char>(v >> (8 * (big ? stride - 1 - k : k))));
+                    }
+                }
+            }
+            const std::string bytes = os.str();
+
+            PlyFile file;
+            REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()));
+            RequestOptions options;
+            options.tristrips = true;
+            options.face_map = true;
+            auto triangles = file.request_properties_from_element("tristrips", { "vertex_indices" }, 0, options);
+            file.read(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+
+            REQUIRE(triangles->count == expected.size() / (3 * stride));
+            REQUIRE(triangles->buffer.size_bytes() == expected.size());
+            CHECK(std::memcmp(triangles->buffer.get(), expected.data(), expected.size()) == 0);
+            CHECK(triangles->list_sizes.empty());
+            CHECK(triangles->triangle_faces == expected_faces);
+        }
+    }
+}
+
+TEST_CASE("row ranges are read through an element index")
+{
+    // Fixed-size vertices around variable-length faces, so both kinds of element have to be located
+    const size_t num_vertices = 1000, num_faces = 777;
+    for (const std::string format : { "binary_little_endian", "binary_big_endian" })
+    {
+        const bool big = format == "binary_big_endian";
+        auto put = [&](std::ostringstream & os, const uint32_t v, const size_t bytes)
+        {
+            for (size_t k = 0; k < bytes; ++k) os.put(static_cast<char>(v >> (8 * (big ? bytes - 1 - k : k))));
+        };
+
+        std::ostringstream os;
+        os << "ply\nformat " << format << " 1.0\nelement vertex " << num_vertices << "\nproperty int x\nproperty uchar red\n";
+        os << "element face " << num_faces << "\nproperty list uchar int vertex_indices\nproperty uchar flags\nend_header\n";
+        for (size_t v = 0; v < num_vertices; ++v) { put(os, static_cast<uint32_t>(v * 3), 4); put(os, static_cast<uint32_t>(v % 256), 1); }
+        for (size_t f = 0; f < num_faces; ++f)
+        {
+            const size_t n = 3 + f % 4;
+            put(os, static_cast<uint32_t>(n), 1);
+            for (size_t k = 0; k < n; ++k) put(os, static_cast<uint32_t>(f * 10 + k), 4);
+            put(os, static_cast<uint32_t>(f % 7), 1);
+        }
+        const std::string bytes = os.str();
+        const uint8_t * data = reinterpret_cast<const uint8_t*>(bytes.data());
+        std::ofstream("row-range.ply", std::ios::binary).write(bytes.data(), bytes.size());
+
+        // Checkpoints every 16 rows, so most ranges start between two of them
+        PlyFile indexer;
+        REQUIRE(indexer.parse_header(data, bytes.size()));
+        const ElementIndex index = indexer.index_elements(data, bytes.size(), 16);
+        REQUIRE(index.elements.size() == 2);
+        CHECK(index.elements[0].row_stride == 5);
+        CHECK(index.elements[1].row_stride == 0);
+        CHECK(index.elements[1].checkpoints.size() == (num_faces + 15) / 16);
+
+        std::istringstream header_is(bytes);
+        PlyFile stream_indexer;
+        REQUIRE(stream_indexer.parse_header(header_is));
+        const ElementIndex stream_index = stream_indexer.index_elements(header_is, 16);
+        CHECK(stream_index.elements[1].checkpoints == index.elements[1].checkpoints);
+        CHECK(stream_indexer.index_elements_file("row-range.ply", 16).elements[1].checkpoints == index.elements[1].checkpoints);
+
+        const std::vector<std::pair<size_t, size_t>> ranges = { { 0, 0 }, { 0, num_faces }, { 5, 100 }, { 16, 32 }, { 640, num_faces }, { num_faces - 1, num_faces } };
+        for (const int source : { 0, 1, 2 })
+        {
+            std::istringstream is(bytes);
+            PlyFile file;
+            REQUIRE(file.parse_header(is));
+            auto x = file.request_properties_from_element("vertex", { "x" });
+            auto faces = file.request_properties_from_element("face", { "vertex_indices" });
+            auto flags = file.request_properties_from_element("face", { "flags" });
+
+            for (const auto & range : ranges)
+            {
+                const size_t begin = range.first, end = range.second;
+                if (source == 0) file.read_rows(data, bytes.size(), index, "face", begin, end);
+                else if (source == 1) file.read_rows(is, index, "face", begin, end);
+                else file.read_rows_file("row-range.ply", index, "face", begin, end);
+
+                std::vector<int32_t> expected;
+                for (size_t f = begin; f < end; ++f)
+                {
+                    for (size_t k = 0; k < 3 + f % 4; ++k) expected.push_back(static_cast<int32_t>(f * 10 + k));
+                }
+                REQUIRE(faces->count == end - begin);
+                REQUIRE(faces->buffer.size_bytes() == expected.size() * sizeof(int32_t));
+                if (!expected.empty()) CHECK(std::memcmp(faces->buffer.get(), expected.data(), faces->buffer.size_bytes()) == 0);
+                REQUIRE(flags->count == end - begin);
+                for (size_t f = begin; f < end; ++f) CHECK(flags->buffer.get()[f - begin] == f % 7);
+                CHECK(x->buffer.get() == nullptr);
+            }
+
+            file.read_rows(data, bytes.size(), index, "vertex", 990, 1000);
+            REQUIRE(x->count == 10);
+            for (size_t v = 0; v < 10; ++v) CHECK(reinterpret_cast<const int32_t*>(x->buffer.get())[v] == static_cast<int32_t>((990 + v) * 3));
+            CHECK(faces->count == 1);
+
+            CHECK_THROWS_AS(file.read_rows(data, bytes.size(), index, "face", 10, num_faces + 1), std::invalid_argument);
+            CHECK_THROWS_AS(file.read_rows(data, bytes.size(), index, "edge", 0, 1), std::invalid_argument);
+
+            // A full read afterwards sees whole elements again
+            file.read(data, bytes.size());
+            CHECK(x->count == num_vertices);
+            CHECK(faces->count == num_faces);
+            CHECK(flags->count == num_faces);
+            CHECK(flags->buffer.get()[num_faces - 1] == (num_faces - 1) % 7);
+        }
+        std::remove("row-range.ply");
+    }
+
+    std::istringstream ascii("ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\nend_header\n1\n");
+    PlyFile file;
+    REQUIRE(file.parse_header(ascii));
+    CHECK_THROWS_AS(file.index_elements(ascii), std::invalid_argument);
+}
+
+TEST_CASE("a sidecar element index sizes variable-length lists and is only reused for the file it describes")
+{
+    const size_t num_faces = 5000;
+    auto make_file = [&](const size_t extra)
+    {
+        std::ostringstream os;
+        os << "ply\nformat binary_little_endian 1.0\nelement face " << num_faces << "\nproperty list uchar int vertex_indices\nproperty list uchar float uv\nend_header\n";
+        for (size_t f = 0; f < num_faces; ++f)
+        {
+            const uint8_t n = static_cast<uint8_t>(3 + (f + extra) % 5);
+            os.put(static_cast<char>(n));
+            for (int32_t k = 0; k < n; ++k) { const int32_t v = static_cast<int32_t>(f) + k; os.write(reinterpret_cast<const char*>(&v), sizeof(v)); }
+            os.put(2);
+            const float uv[2] = { 0.5f, 1.5f };
+            os.write(reinterpret_cast<const char*>(uv), sizeof(uv));
+        }
+        std::ofstream("sidecar.ply", std::ios::binary).write(os.str().data(), os.str().size());
+    };
+    make_file(0);
+
+    size_t total_indices = 0, indices_before_1024 = 0;
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+        if (f == 1024) indices_before_1024 = total_indices;
+        total_indices += 3 + f % 5;
+    }
+
+    PlyFile indexer;
+    REQUIRE(indexer.parse_header_file("sidecar.ply"));
+    const ElementIndex index = indexer.index_elements_file("sidecar.ply", 1024);
+    REQUIRE(index.elements.size() == 1);
+    const auto & entry = index.elements[0];
+    REQUIRE(entry.checkpoints.size() == 5);
+    REQUIRE(entry.list_items.size() == 2 * 6);
+    CHECK(entry.list_items[2] == indices_before_1024);
+    CHECK(entry.list_items[3] == 1024 * 2);
+    CHECK(entry.list_items[10] == total_indices);
+    CHECK(entry.list_items[11] == num_faces * 2);
+    indexer.save_index_file("sidecar.ply.idx", index);
+
+    for (const bool presize : { false, true })
+    {
+        PlyFile file;
+        REQUIRE(file.parse_header_file("sidecar.ply"));
+        auto loaded = std::make_shared<ElementIndex>();
+        REQUIRE(file.load_index_file("sidecar.ply.idx", "sidecar.ply", *loaded));
+        CHECK(loaded->elements[0].checkpoints == entry.checkpoints);
+        CHECK(loaded->elements[0].list_items == entry.list_items);
+
+        file.get_read_options().element_index = loaded;
+        file.get_read_options().presize_lists = presize;
+        auto faces = file.request_properties_from_element("face", { "vertex_indices" });
+        file.read_file("sidecar.ply");
+        REQUIRE(faces->buffer.size_bytes() == total_indices * sizeof(int32_t));
+        REQUIRE(faces->list_sizes.size() == num_faces);
+        size_t offset = 0;
+        for (size_t f = 0; f < num_faces; ++f)
+        {
+            CHECK(faces->list_sizes[f] == 3 + f % 5);
+            CHECK(reinterpret_cast<const int32_t*>(faces->buffer.get())[offset] == static_cast<int32_t>(f));
+            offset += faces->list_sizes[f];
+        }
+    }
+
+    // Another header, or the file rewritten in place, invalidate the sidecar
+    PlyFile other;
+    std::istringstream other_header("ply\nformat binary_little_endian 1.0\nelement face 1\nproperty list uchar int vertex_indices\nend_header\n");
+    REQUIRE(other.parse_header(other_header));
+    ElementIndex unchanged;
+    CHECK_FALSE(other.load_index_file("sidecar.ply.idx", "sidecar.ply", unchanged));
+    CHECK(unchanged.elements.empty());
+    other.get_read_options().element_index = std::make_shared<ElementIndex>(index);
+    other.request_properties_from_element("face", { "vertex_indices" });
+    CHECK_THROWS_AS(other.read_file("sidecar.ply"), std::invalid_argument);
+
+    // Truncated or corrupt sidecars are rejected without allocating what they claim
+    std::ostringstream sidecar;
+    sidecar << std::ifstream("sidecar.ply.idx", std::ios::binary).rdbuf();
+    auto check_rejected = [&](const std::string & bytes)
+    {
+        std::ofstream("corrupt.ply.idx", std::ios::binary).write(bytes.data(), bytes.size());
+        PlyFile file;
+        REQUIRE(file.parse_header_file("sidecar.ply"));
+        ElementIndex untouched;
+        CHECK_FALSE(file.load_index_file("corrupt.ply.idx", "sidecar.ply", untouched));
+        CHECK(untouched.elements.empty());
+    };
+    for (const uint64_t num_checkpoints : { uint64_t(1) << 39, uint64_t(6) })
+    {
+        std::string bytes = sidecar.str();
+        bytes.replace(64, sizeof(num_checkpoints), reinterpret_cast<const char*>(&num_checkpoints), sizeof(num_checkpoints));
+        check_rejected(bytes);
+    }
+    check_rejected(sidecar.str().substr(0, sidecar.str().size() - 8));
+    check_rejected(sidecar.str().substr(0, 60));
+    std::remove("corrupt.ply.idx");
+
+    make_file(1);
+    PlyFile stale;
+    REQUIRE(stale.parse_header_file("sidecar.ply"));
+    CHECK_FALSE(stale.load_index_file("sidecar.ply.idx", "sidecar.ply", unchanged));
+    CHECK_FALSE(stale.load_index_file("missing.idx", "sidecar.ply", unchanged));
+
+    std::remove("sidecar.ply");
+    std::remove("sidecar.ply.idx");
+}
+
+TEST_CASE("ascii values are tokenized like istream extraction")
+{
+    const std::string header =
+        "ply\n"
+        "format ascii 1.0\n"
+        "element vertex 3\n"
+        "property float x\n"
+        "property double y\n"
+        "property uchar c\n"
+        "property ushort u\n"
+        "property int i\n"
+        "element face 1\n"
+        "property list uchar uint vertex_indices\n"
+        "end_header\n";
+    // Explicit signs, exponents, all kinds of whitespace and values that wrap like they do for istream extraction
+    const std::string payload =
+        "+1.5 -2e3 300 -1 +7\r\n"
+        "\t.25\v1E-2\f255 65535 -2147483648\n"
+        "-0 1e-320 0 +0 2147483647\n"
+        "3 0 +1 -2\n";
+
+    for (const bool span : { false, true })
+    {
+        const std::string bytes = header + payload;
+        std::istringstream stream(bytes);
+        PlyFile file;
+        if (span) REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()));
+        else REQUIRE(file.parse_header(stream));
+        auto x = file.request_properties_from_element("vertex", { "x" });
+        auto y = file.request_properties_from_element("vertex", { "y" });
+        auto c = file.request_properties_from_element("vertex", { "c" });
+        auto u = file.request_properties_from_element("vertex", { "u" });
+        auto i = file.request_properties_from_element("vertex", { "i" });
+        auto faces = file.request_properties_from_element("face", { "vertex_indices" });
+        if (span) file.read(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+        else file.read(stream);
+
+        const float * xs = reinterpret_cast<const float*>(x->buffer.get());
+        const double * ys = reinterpret_cast<const double*>(y->buffer.get());
+        const uint8_t * cs = c->buffer.get();
+        const uint16_t * us = reinterpret_cast<const uint16_t*>(u->buffer.get());
+        const int32_t * is = reinterpret_cast<const int32_t*>(i->buffer.get());
+        const uint32_t * fs = reinterpret_cast<const uint32_t*>(faces->buffer.get());
+        CHECK(xs[0] == 1.5f);
+        CHECK(xs[1] == 0.25f);
+        CHECK(xs[2] == 0.0f);
+        CHECK(ys[0] == -2000.0);
+        CHECK(ys[1] == 0.01);
+        CHECK(ys[2] == 1e-320);
+        CHECK(cs[0] == 44);
+        CHECK(cs[1] == 255);
+        CHECK(us[0] == 65535);
+        CHECK(us[2] == 0);
+        CHECK(is[0] == 7);
+        CHECK(is[1] == -2147483647 - 1);
+        CHECK(is[2] == 2147483647);
+        REQUIRE(faces->count == 1);
+        CHECK(fs[0] == 0);
+        CHECK(fs[1] == 1);
+        CHECK(fs[2] == 4294967294u);
+    }
+
+    // Out-of-range values and anything that is not a decimal number still fail the read
+    for (const std::string bad : { "nan", "inf", "1e", "+-1", "1e40", "70000", "x" })
+    {
+        const std::string bytes = "ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\nproperty ushort u\nend_header\n" +
+            (bad == "70000" ? "1 " + bad : bad + " 1") + "\n";
+        std::istringstream stream(bytes);
+        PlyFile file;
+        REQUIRE(file.parse_header(stream));
+        file.request_properties_from_element("vertex", { "x" });
+        file.request_properties_from_element("vertex", { "u" });
+        CHECK_THROWS_AS(file.read(stream), std::runtime_error);
+    }
+
+    // Large payloads are tokenized in chunks from a stream; tokens cut by a chunk boundary are carried over
+    std::string big = "ply\nformat ascii 1.0\nelement vertex 40000\nproperty float x\nproperty int i\nelement face 40000\nproperty list uchar int vertex_indices\nend_header\n";
+    for (int r = 0; r < 40000; ++r) big += std::to_string(r) + ".125 " + std::to_string(-r) + "\n";
+    for (int r = 0; r < 40000; ++r) big += "3 " + std::to_string(r) + " " + std::to_string(r + 1) + " " + std::to_string(r + 2) + "\n";
+    std::istringstream big_stream(big);
+    PlyFile big_file;
+    REQUIRE(big_file.parse_header(big_stream));
+    auto bx = big_file.request_properties_from_element("vertex", { "x" });
+    auto bf = big_file.request_properties_from_element("face", { "vertex_indices" });
+    big_file.read(big_stream);
+    REQUIRE(bx->count == 40000);
+    REQUIRE(bf->list_sizes.empty());
+    REQUIRE(bf->buffer.size_bytes() == 40000 * 3 * sizeof(int32_t));
+    const float * bxs = reinterpret_cast<const float*>(bx->buffer.get());
+    const int32_t * bfs = reinterpret_cast<const int32_t*>(bf->buffer.get());
+    for (int r = 0; r < 40000; ++r)
+    {
+        if (bxs[r] != static_cast<float>(r) + 0.125f) { CHECK(bxs[r] == static_cast<float>(r) + 0.125f); break; }
+        if (bfs[3 * r + 2] != r + 2) { CHECK(bfs[3 * r + 2] == r + 2); break; }
+    }
+}
+
+TEST_CASE("large in-memory ascii elements are parsed in parallel line chunks")
+{
+    // Rows that wrap over two lines cannot be split by line and are left to the serial parser
+    const size_t num_wrapped = 100000, num_vertices = 300000, num_faces = 400000;
+    std::string ply = "ply\nformat ascii 1.0\n"
+        "element wrapped " + std::to_string(num_wrapped) + "\nproperty int a\nproperty int b\n"
+        "element vertex " + std::to_string(num_vertices) + "\nproperty float x\nproperty float y\nproperty float z\nproperty uchar red\n"
+        "element face " + std::to_string(num_faces) + "\nproperty list uchar int vertex_indices\nend_header\n";
+    for (size_t r = 0; r < num_wrapped; ++r) ply += std::to_string(r) + "\n" + std::to_string(2 * r) + "\n";
+    for (size_t r = 0; r < num_vertices; ++r) ply += std::to_string(r) + ".5 " + std::to_string(r % 97) + " -" + std::to_string(r % 13) + ".25 " + std::to_string(r % 256) + "\n";
+    for (size_t r = 0; r < num_faces; ++r)
+    {
+        ply += std::to_string(3 + r % 2);
+        for (size_t i = 0; i < 3 + r % 2; ++i) ply += " " + std::to_string((r + i) % num_vertices);
+        ply += "\n";
+    }
+    const uint8_t * data = reinterpret_cast<const uint8_t*>(ply.data());
+
+    std::vector<std::vector<uint8_t>> expected;
+    for (const uint32_t threads : { 1u, 4u })
+    {
+        PlyFile file;
+        REQUIRE(file.parse_header(data, ply.size()));
+        file.get_read_options().num_threads = threads;
+        std::vector<std::shared_ptr<PlyData>> requested;
+        requested.push_back(file.request_properties_from_element("wrapped", { "a", "b" }));
+        requested.push_back(file.request_properties_from_element("vertex", { "x", "y", "z" }));
+        requested.push_back(file.request_properties_from_element("vertex", { "red" }));
+        requested.push_back(file.request_properties_from_element("face", { "vertex_indices" }));
+        file.read(data, ply.size());
+
+        const auto & faces = requested.back();
+        REQUIRE(faces->list_sizes.size() == num_faces);
+        const int32_t * indices = reinterpret_cast<const int32_t*>(faces->buffer.get());
+        CHECK(faces->list_sizes[num_faces - 1] == 3 + (num_faces - 1) % 2);
+        CHECK(indices[faces->buffer.size_bytes() / sizeof(int32_t) - 1] == static_cast<int32_t>((num_faces + 2) % num_vertices));
+        CHECK(reinterpret_cast<const int32_t*>(requested[0]->buffer.get())[2 * num_wrapped - 1] == static_cast<int32_t>(2 * (num_wrapped - 1)));
+        CHECK(reinterpret_cast<const float*>(requested[1]->buffer.get())[3 * (num_vertices - 1)] == static_cast<float>(num_vertices - 1) + 0.5f);
+
+        std::vector<uint8_t> all;
+        for (const auto & d : requested) all.insert(all.end(), d->buffer.get(), d->buffer.get() + d->buffer.size_bytes());
+        for (const size_t size : faces->list_sizes) all.push_back(static_cast<uint8_t>(size));
+        expected.push_back(std::move(all));
+    }
+    CHECK(expected[0] == expected[1]);
+}
+
+TEST_CASE("ascii tokens are found across runs of whitespace of any length")
+{
+    // Separators of 1 to 150 mixed whitespace bytes put tokens on both sides of every classified block boundary
+    const std::string spaces = " \t\r\n\v\f";
+    std::string payload;
+    const uint32_t count = 150;
+    for (uint32_t k = 0; k < count; ++k)
+    {
+        payload += std::to_string(k * 7919u);
+        for (uint32_t s = 0; s <= k; ++s) payload += spaces[(k + s) % spaces.size()];
+    }
+    const std::string bytes = "ply\nformat ascii 1.0\nelement vertex " + std::to_string(count / 2) + "\nproperty uint a\nproperty uint b\nend_header\n" + payload;
+
+    for (const bool span : { false, true })
+    {
+        std::istringstream stream(bytes);
+        PlyFile file;
+        if (span) REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()));
+        else REQUIRE(file.parse_header(stream));
+        auto a = file.request_properties_from_element("vertex", { "a" });
+        if (span) file.read(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+        else file.read(stream);
+
+        const uint32_t * as = reinterpret_cast<const uint32_t*>(a->buffer.get());
+        for (uint32_t k = 0; k < count / 2; ++k) CHECK(as[k] == 2 * k * 7919u);
+    }
+}
+
+TEST_CASE("unrequested ascii values and elements are stepped over without being parsed")
+{
+    // Skipped values are never converted, so even tokens that are not numbers pass. Rows wrap across lines
+    // and list counts of a skipped list are still honoured.
+    std::string payload;
+    const uint32_t count = 200;
+    for (uint32_t k = 0; k < count; ++k)
+        payload += "junk" + std::to_string(k) + (k % 3 ? " " : "\n") + std::to_string(k) + " 2 skip-me nan " + std::to_string(k) + " 1e999\n";
+    for (uint32_t k = 0; k < count; ++k) payload += std::string("x y\tz ") + (k % 2 ? "\r\n" : "\n");
+    for (uint32_t k = 0; k < count; ++k) payload += std::to_string(k) + "\n";
+    const std::string bytes =
+        "ply\nformat ascii 1.0\n"
+        "element vertex " + std::to_string(count) + "\nproperty float name\nproperty int a\nproperty list uchar float junk\nproperty int b\nproperty float c\n"
+        "element normal " + std::to_string(count) + "\nproperty float nx\nproperty float ny\nproperty float nz\n"
+        "element id " + std::to_string(count) + "\nproperty uint id\n"
+        "end_header\n" + payload;
+
+    for (const bool span : { false, true })
+    {
+        std::istringstream stream(bytes);
+        PlyFile file;
+        if (span) REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()));
+        else REQUIRE(file.parse_header(stream));
+        auto a = file.request_properties_from_element("vertex", { "a" });
+        auto b = file.request_properties_from_element("vertex", { "b" });
+        auto id = file.request_properties_from_element("id", { "id" });
+        if (span) file.read(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+        else file.read(stream);
+
+        const int32_t * as = reinterpret_cast<const int32_t*>(a->buffer.get());
+        const int32_t * bs = reinterpret_cast<const int32_t*>(b->buffer.get());
+        const uint32_t * ids = reinterpret_cast<const uint32_t*>(id->buffer.get());
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            CHECK(as[k] == int32_t(k));
+            CHECK(bs[k] == int32_t(k));
+            CHECK(ids[k] == k);
+        }
+    }
+
+    // Running out of values while skipping is still an error
+    const std::string truncated = bytes.substr(0, bytes.find("x y"));
+    PlyFile file;
+    REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(truncated.data()), truncated.size()));
+    file.request_properties_from_element("id", { "id" });
+    CHECK_THROWS(file.read(reinterpret_cast<const uint8_t*>(truncated.data()), truncated.size()));
+}
+
+TEST_CASE("ascii integers of any digit count parse like istream extraction")
+{
+    // Values with up to 7 digits take the single-load path; longer ones (and leading zeros) are parsed 8 digits
+    // at a time and still range-checked
+    const std::string bytes =
+        "ply\nformat ascii 1.0\nelement face 3\nproperty list uchar uint vertex_indices\nproperty short s\nend_header\n"
+        "4 1 22 333 4444 -32768\n"
+        "03 4294967295 00000000000000000007 1234567 +32767\n"
+        "2 12345678 123456789 -1\n";
+
+    for (const bool span : { false, true })
+    {
+        std::istringstream stream(bytes);
+        PlyFile file;
+        if (span) REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()));
+        else REQUIRE(file.parse_header(stream));
+        auto faces = file.request_properties_from_element("face", { "vertex_indices" });
+        auto shorts = file.request_properties_from_element("face", { "s" });
+        if (span) file.read(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+        else file.read(stream);
+
+        const std::vector<uint32_t> expected = { 1, 22, 333, 4444, 4294967295u, 7, 1234567, 12345678, 123456789 };
+        REQUIRE(faces->buffer.size_bytes() == expected.size() * sizeof(uint32_t));
+        CHECK(std::equal(expected.begin(), expected.end(), reinterpret_cast<const uint32_t*>(faces->buffer.get())));
+        const int16_t * ss = reinterpret_cast<const int16_t*>(shorts->buffer.get());
+        CHECK(ss[0] == -32768);
+        CHECK(ss[1] == 32767);
+        CHECK(ss[2] == -1);
+    }
+
+    for (const std::string value : { "4294967296", "000000000000099999999999", "-", "x1" })
+    {
+        const std::string bad = "ply\nformat ascii 1.0\nelement vertex 1\nproperty uint v\nend_header\n" + value + "\n";
+        PlyFile file;
+        REQUIRE(file.parse_header(reinterpret_cast<const uint8_t*>(bad.data()), bad.size()));
+        file.request_properties_from_element("vertex", { "v" });
+        CHECK_THROWS(file.read(reinterpret_cast<const uint8_t*>(bad.data()), bad.size()));
+    }
+}
@@ -2,7 +2,7 @@
  * tinyply 3.0 (https://github.com/ddiakopoulos/tinyply)
  *
  * A single-header, zero-dependency (except the C++ STL) public domain implementation
- * of the PLY mesh file format. Requires C++11; errors are handled through exceptions.
+ * of the PLY mesh file format. Requires C++17; errors are handled through exceptions.
  *
  * This software is in the public domain. Where that dedication is not
  * recognized, you are granted a perpetual, irrevocable license to copy,
@@ -81,10 +81,13 @@ namespace tinyply
         struct delete_array { void operator()(uint8_t * p) { delete[] p; } };
         std::unique_ptr<uint8_t, decltype(Buffer::delete_array())> data;
         size_t size {0};
+        std::shared_ptr<const void> owner; // keeps the memory behind a non-allocating view alive
     public:
         Buffer() {};
         Buffer(const size_t size) : data(new uint8_t[size], delete_array()), size(size) { alias = data.get(); } // allocating
         Buffer(const uint8_t * ptr): alias(const_cast<uint8_t*>(ptr)) { } // non-allocating, todo: set size?
+        Buffer(const uint8_t * ptr, const size_t size, std::shared_ptr<const void> owner) // non-allocating view
+            : alias(const_cast<uint8_t*>(ptr)), size(size), owner(owner) { }
         uint8_t * get() { return alias; }
         const uint8_t * get_const() const {return alias; }
         size_t size_bytes() const { return size; }
@@ -97,6 +100,120 @@ namespace tinyply
         size_t count {0};
         bool isList {false};
         std::vector<size_t> list_sizes; // per-item list counts (empty = fixed-length)
+        size_t stride {0}; // zero-copy views only: bytes between consecutive items in `buffer` (0 = tightly packed)
+        std::map<size_t, size_t> list_size_histogram; // lists requested with `auto_list_size_hint`: items per list count
+        Buffer list_offsets; // `RequestOptions::list_offsets` only: count + 1 prefix sums of the list sizes (empty = fixed-length)
+        Type list_offsets_type {Type::INVALID}; // UINT8, UINT16 or UINT32, the narrowest type that holds the total
+        std::vector<uint32_t> triangle_faces; // `RequestOptions::face_map` only: the row each triangle was cut from
+
+        // Items stored before list `i`, which spans [list_offset(i), list_offset(i + 1)) of `buffer`
+        size_t list_offset(const size_t i) const
+        {
+            switch (list_offsets_type)
+            {
+            case Type::UINT8:  return list_offsets.get_const()[i];
+            case Type::UINT16: return reinterpret_cast<const uint16_t *>(list_offsets.get_const())[i];
+            default:           return reinterpret_cast<const uint32_t *>(list_offsets.get_const())[i];
+            }
+        }
+    };
+
+    // Pass as `list_size_hint` to have the list size detected from the data. The first rows are sampled and
+    // the list is read as if their size had been hinted; if a later row disagrees, reading continues from that
+    // row as a variable-length list. Either way, `PlyData::list_size_histogram` reports the sizes encountered.
+    constexpr uint32_t auto_list_size_hint = 0xffffffff;
+
+    struct RequestOptions
+    {
+        // Rather than copying into a new allocation, point `PlyData::buffer` directly at the rows of the source.
+        // Honored for a group of adjacent, non-list properties of a fixed-size element, in a binary little-endian
+        // file read with `read(const uint8_t *, size_t)` or `read_file(...)`; in every other case the data is
+        // copied as usual. A view has a non-zero `PlyData::stride`, and items are found at `buffer.get() + i * stride`.
+        // Views into a mapped file keep the mapping alive; views into a user span require the span to outlive them.
+        bool zero_copy {false};
+
+        // Variable-length lists only: describe the lists with prefix sums in `PlyData::list_offsets` rather than
+        // per-item sizes in `PlyData::list_sizes`, so any list is located in O(1) at a fraction of the memory.
+        // Sums are recorded as rows are parsed and stored in the narrowest unsigned type holding the total; lists
+        // totalling more than 2^32 - 1 items fall back to `list_sizes`.
+        bool list_offsets {false};
+
+        // Lists only: fan-triangulate each list (a polygon of n indices) into n - 2 triangles while reading. The
+        // buffer then holds 3 indices per triangle and `PlyData::count` is the number of triangles; lists of fewer
+        // than three indices produce none. A `list_size_hint` (e.g. 4 for quads) still sizes the buffer up front and
+        // keeps binary faces on the bulk path.
+        bool triangulate {false};
+
+        // Lists only: decode each list as triangle strips (e.g. `tristrips.vertex_indices`) into a triangle list while
+        // reading, like `triangulate`. Strips within a list are separated by a restart index of -1 (all bits set),
+        // every other triangle is flipped to keep the strip's winding, and degenerate triangles are dropped.
+        bool tristrips {false};
+
+        // With `triangulate` or `tristrips`: record in `PlyData::triangle_faces` which row each triangle came from
+        bool face_map {false};
+    };
+
+    /*
+     * Runs `job(i)` for every i in [0, count) and returns once all of them have completed, for example by
+     * forwarding to an application's job system. Jobs are independent and may run concurrently.
+     */
+    using ParallelExecutor = std::function<void(size_t count, const std::function<void(size_t)> & job)>;
+
+    struct ElementIndex;
+
+    struct ReadOptions
+    {
+        // Threads used by the parallel stages of `read` (1 = serial, 0 = std::thread::hardware_concurrency()).
+        // Reads stay on the calling thread unless this is raised; work is only split up when an element is
+        // large enough to benefit.
+        uint32_t num_threads {1};
+
+        // If set, parallel work is dispatched through this executor instead of threads spawned by tinyply.
+        // `num_threads` still decides how many tasks the work is split into.
+        ParallelExecutor executor;
+
+        // Upper bound on the rows of a binary element staged at once when reading from a stream (rounded down
+        // to whole rows, at least one). Rows are read and scattered chunk by chunk, so this caps the memory
+        // used on top of the destination buffers. In-memory sources are scattered in place and ignore it.
+        size_t staging_bytes {size_t(16) << 20};
+
+        // Elements whose destination buffers add up to at least this many bytes are written with non-temporal
+        // stores that bypass the cache (0 = never). Only worth enabling when destinations dwarf the last-level
+        // cache and are not read back soon. Applies to properties de-interleaved with SIMD transposes.
+        size_t non_temporal_bytes {0};
+
+        // Variable-length lists (a `list_size_hint` of zero) are read in a single pass into buffers that grow as
+        // rows are parsed and are trimmed once the read completes, which also works for non-seekable streams.
+        // Set this to size them exactly with a counting pass over the payload first, which requires a seekable source.
+        bool presize_lists {false};
+
+        // An index of the file being read (see `PlyFile::index_elements(...)`). It sizes the buffers of variable-length
+        // lists exactly up front, so they neither grow while parsing nor need the counting pass of `presize_lists`.
+        std::shared_ptr<const ElementIndex> element_index;
+    };
+
+    /*
+     * Where the rows of each element of a binary ply file start, in bytes from the start of the file. Built once by
+     * `PlyFile::index_elements(...)` and passed to `PlyFile::read_rows(...)`, which then seeks straight to any row.
+     * Rows of a fixed size are addressed directly; elements with variable-length lists keep the offset of every
+     * `interval`-th row and step over the rows in between.
+     */
+    struct ElementIndex
+    {
+        struct Entry
+        {
+            uint64_t offset {0};               // the element's first row
+            uint64_t row_stride {0};           // fixed-size rows: row i starts at `offset + i * row_stride` (0 = variable)
+            std::vector<uint64_t> checkpoints; // variable-size rows: where rows 0, interval, 2 * interval, ... start
+            std::vector<uint64_t> list_items;  // items of each list property before every checkpoint, then in the whole element
+        };
+        uint64_t interval {uint64_t(1) << 16}; // rows between checkpoints
+        std::vector<Entry> elements;           // in header order
+
+        // The file the index was built from: its size and modification time (files only, 0 otherwise) and its header
+        uint64_t file_size {0};
+        int64_t file_mtime {0};
+        uint32_t header_hash {0};
     };
 
     struct PlyProperty
@@ -143,6 +260,58 @@ namespace tinyply
          */
         void read(std::istream & is);
 
+        /*
+         * Span-based equivalents of `parse_header(...)` and `read(...)` for ply files that are already
+         * resident in memory. Both take the complete file, header included; `read` locates the payload
+         * itself. Binary payloads are parsed by walking a pointer over the span, so no copies, seeks or
+         * stream state checks are involved. The memory only needs to remain valid for the duration of each call.
+         */
+        bool parse_header(const uint8_t * data, const size_t size);
+        void read(const uint8_t * data, const size_t size);
+
+        /*
+         * Memory-maps the file at `filepath` and parses the header directly out of the mapped region.
+         * The mapping is retained by this PlyFile and reused by `read_file(...)` on the same path,
+         * so large payloads are neither staged into an intermediate copy nor pulled through a std::istream.
+         */
+        bool parse_header_file(const std::string & filepath);
+
+        /*
+         * Memory-mapped equivalent of `read(...)`. The header may have been parsed by either
+         * `parse_header_file(...)` or `parse_header(...)`; the payload is located by scanning for `end_header`.
+         */
+        void read_file(const std::string & filepath);
+
+        /*
+         * Builds the `ElementIndex` of a binary file whose header has been parsed. Only elements with variable-length
+         * lists are walked (once, reading just their list counts); fixed-size elements are measured from the header.
+         * The stream must be positioned at the payload, as left by `parse_header(...)`, and count its positions from
+         * the start of the file, like a std::ifstream.
+         */
+        ElementIndex index_elements(std::istream & is, const uint64_t interval = uint64_t(1) << 16);
+        ElementIndex index_elements(const uint8_t * data, const size_t size, const uint64_t interval = uint64_t(1) << 16);
+        ElementIndex index_elements_file(const std::string & filepath, const uint64_t interval = uint64_t(1) << 16);
+
+        /*
+         * Reads rows [begin, end) of `elementKey` into the data requested from that element, seeking through `index`
+         * instead of parsing the payload before them. Each call replaces what those requests hold: `count` becomes
+         * `end - begin`, and `triangle_faces` counts rows from `begin`. Requests on other elements are left untouched.
+         * Streams are seeked to the offsets in `index`; `read_rows_file(...)` reads just the range through a file stream.
+         */
+        void read_rows(std::istream & is, const ElementIndex & index, const std::string & elementKey, const size_t begin, const size_t end);
+        void read_rows(const uint8_t * data, const size_t size, const ElementIndex & index, const std::string & elementKey, const size_t begin, const size_t end);
+        void read_rows_file(const std::string & filepath, const ElementIndex & index, const std::string & elementKey, const size_t begin, const size_t end);
+
+        /*
+         * Sidecar indexes let later runs of the same file skip the walk behind `index_elements(...)`. `save_index_file`
+         * writes `index` to `indexpath` (in this machine's byte order). `load_index_file` reads it back and returns false,
+         * leaving `index` untouched, unless it was built from `filepath` as it is now: the same size, modification time
+         * and header (parsed into this PlyFile). A truncated or corrupt sidecar also returns false rather than throwing.
+         * Rebuild and save the index whenever it returns false.
+         */
+        void save_index_file(const std::string & indexpath, const ElementIndex & index) const;
+        bool load_index_file(const std::string & indexpath, const std::string & filepath, ElementIndex & index) const;
+
         /*
          * `write` performs no validation and assumes that the data passed into
          * `add_properties_to_element` is well-formed.
@@ -156,18 +325,22 @@ namespace tinyply
         std::vector<PlyElement> get_elements() const;
         std::vector<std::string> get_info() const;
         std::vector<std::string> & get_comments();
+        ReadOptions & get_read_options();
         bool is_binary_file() const;
         bool is_big_endian() const;
 
         /*
-         * In the general case where |list_size_hint| is zero, `read` performs a two-pass
-         * parse to support variable length lists. The most general use of the
-         * ply format is storing triangle meshes. When this fact is known a-priori, we can pass
+         * In the general case where |list_size_hint| is zero, `read` supports variable length
+         * lists by growing their buffer as rows are parsed (see `ReadOptions::presize_lists`). The most
+         * general use of the ply format is storing triangle meshes. When this fact is known a-priori, we can pass
          * an expected list length that will apply to this element. Doing so results in an up-front
-         * memory allocation and a single-pass import, a 2x performance optimization.
+         * memory allocation and a copy-free import, with each list count validated against the hint.
+         * Pass `auto_list_size_hint` to get the hinted performance whenever the lists turn out to share a size.
+         * Additional, opt-in behaviors (e.g. zero-copy views) are selected through `options`.
          */
         std::shared_ptr<PlyData> request_properties_from_element(const std::string & elementKey,
-            const std::vector<std::string> propertyKeys, const uint32_t list_size_hint = 0);
+            const std::vector<std::string> propertyKeys, const uint32_t list_size_hint = 0,
+            const RequestOptions & options = RequestOptions());
 
         void add_properties_to_element(const std::string & elementKey,
             const std::vector<std::string> propertyKeys,
@@ -189,9 +362,60 @@ namespace tinyply
 #ifdef TINYPLY_IMPLEMENTATION
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <type_traits>
 #include <cstring>
+#include <cctype>
+#include <charconv>
+#include <limits>
+#include <istream>
+#include <fstream>
+#include <streambuf>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <intrin.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// SIMD transpose kernels for the binary scatter; define TINYPLY_NO_SIMD to use the scalar kernels only
+#if !defined(TINYPLY_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define TINYPLY_SSE2
+        #include <emmintrin.h>
+    #endif
+    #if defined(__SSSE3__) || defined(__AVX__)
+        #define TINYPLY_SSSE3
+        #include <tmmintrin.h>
+    #endif
+    #if defined(__AVX2__)
+        #define TINYPLY_AVX2
+        #include <immintrin.h>
+    #endif
+#endif
+
+#if defined(_MSC_VER) && defined(TINYPLY_SSE2)
+    #define TINYPLY_PREFETCH(p) _mm_prefetch(reinterpret_cast<const char *>(p), _MM_HINT_T1)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define TINYPLY_PREFETCH(p) __builtin_prefetch((p), 0, 2)
+#else
+    #define TINYPLY_PREFETCH(p) ((void)(p))
+#endif
 
 namespace tinyply
 {
@@ -240,280 +464,1333 @@ inline Type property_type_from_string(const std::string & t) noexcept
     return Type::INVALID;
 }
 
-template<typename T, typename T2> inline void endian_swap_buffer(uint8_t * data_ptr, const size_t num_bytes, const size_t stride)
-{
-    for (size_t count = 0; count < num_bytes; count += stride)
-    {
-        *(reinterpret_cast<T2*>(data_ptr)) = endian_swap<T, T2>(*(reinterpret_cast<const T*>(data_ptr)));
-        data_ptr += stride;
-    }
-}
-template<typename T> inline T ply_read_ascii(std::istream & is)
-{
-    T data;
-    is >> data;
-    if (is.fail())
-        throw std::runtime_error("failed to read ascii property value");
-    if (std::is_floating_point<T>::value && std::isnan(static_cast<double>(data)))
-        throw std::runtime_error("NaN values are not supported in ascii PLY files");
-    return data;
-}
-
-template<typename T> inline void ply_cast_ascii(void* dest, std::istream & is)
-{
-    *(static_cast<T*>(dest)) = ply_read_ascii<T>(is);
-}
-
-inline void fast_read(std::istream & is, char * dest, std::streamsize count)
+#if defined(TINYPLY_SSSE3)
+template<size_t Width> inline __m128i byte_swap_mask() noexcept
 {
-    if (is.rdbuf()->sgetn(dest, count) != count) throw std::runtime_error("failed to read binary data (unexpected EOF or stream error)");
+    if constexpr (Width == 2) return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    else if constexpr (Width == 4) return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    else return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
 }
-
-inline void validate_list_hint(uint32_t actual, uint32_t hint)
+template<size_t Width> inline __m128i byte_swap_128(const __m128i v) noexcept { return _mm_shuffle_epi8(v, byte_swap_mask<Width>()); }
+#elif defined(TINYPLY_SSE2)
+// Without pshufb: swap the bytes of each 16-bit word, then reverse the words within each item
+template<size_t Width> inline __m128i byte_swap_128(const __m128i v) noexcept
 {
-    if (hint > 0 && actual != hint)
-        throw std::runtime_error("list_size_hint mismatch: hint=" + std::to_string(hint) +
-            ", actual=" + std::to_string(actual) + ". Use list_size_hint=0 for variable-length lists.");
+    const __m128i s = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    if constexpr (Width == 2) return s;
+    else if constexpr (Width == 4) return _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xB1), 0xB1);
+    else return _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0x1B), 0x1B);
 }
+#endif
+#if defined(TINYPLY_AVX2)
+template<size_t Width> inline __m256i byte_swap_256(const __m256i v) noexcept { return _mm256_shuffle_epi8(v, _mm256_broadcastsi128_si256(byte_swap_mask<Width>())); }
+#endif
 
-inline size_t read_list_count_binary(const Type & t, const size_t& stride, uint32_t * dest, size_t & destOffset, std::istream & is, bool be)
+// Reverses the bytes of `num_items` consecutive `Width`-byte items in place
+template<size_t Width> inline void byte_swap_items(uint8_t * data, const size_t num_items) noexcept
 {
-    destOffset += stride;
-
-    // Read into a temporary buffer sized for the largest valid list count type (4 bytes)
-    // This prevents stack buffer overflow if stride > sizeof(uint32_t)
-    uint8_t temp[4] = {0, 0, 0, 0};
-    if (stride > 4) throw std::runtime_error("invalid list count type: stride exceeds 4 bytes (list counts must be integer types");
-
-    fast_read(is, (char*)temp, stride);
+    static_assert(Width == 2 || Width == 4 || Width == 8, "unsupported item width");
+    typedef typename std::conditional<Width == 2, uint16_t, typename std::conditional<Width == 4, uint32_t, uint64_t>::type>::type word_t;
 
-    // Convert to uint32_t based on source type
-    uint32_t value = 0;
-    switch (t)
+    const size_t num_bytes = num_items * Width;
+    size_t i = 0;
+#if defined(TINYPLY_AVX2)
+    for (; i + 32 <= num_bytes; i += 32)
     {
-    case Type::INT8: value = static_cast<uint32_t>(*reinterpret_cast<int8_t*>(temp)); break;
-    case Type::UINT8: value = static_cast<uint32_t>(*reinterpret_cast<uint8_t*>(temp)); break;
-    case Type::INT16: if (be) *reinterpret_cast<int16_t*>(temp) = endian_swap<int16_t, int16_t>(*reinterpret_cast<int16_t*>(temp)); value = static_cast<uint32_t>(*reinterpret_cast<int16_t*>(temp));break;
-    case Type::UINT16: if (be) *reinterpret_cast<uint16_t*>(temp) = endian_swap<uint16_t, uint16_t>(*reinterpret_cast<uint16_t*>(temp)); value = static_cast<uint32_t>(*reinterpret_cast<uint16_t*>(temp)); break;
-    case Type::INT32: if (be) *reinterpret_cast<int32_t*>(temp) = endian_swap<int32_t, int32_t>(*reinterpret_cast<int32_t*>(temp)); value = static_cast<uint32_t>(*reinterpret_cast<int32_t*>(temp)); break;
-    case Type::UINT32: if (be) *reinterpret_cast<uint32_t*>(temp) = endian_swap<uint32_t, uint32_t>(*reinterpret_cast<uint32_t*>(temp)); value = *reinterpret_cast<uint32_t*>(temp); break;
-    default: throw std::runtime_error("invalid list count type: must be an integer type (int8, uint8, int16, uint16, int32, uint32)");
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + i), byte_swap_256<Width>(v));
+    }
+#endif
+#if defined(TINYPLY_SSE2)
+    for (; i + 16 <= num_bytes; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(data + i), byte_swap_128<Width>(v));
+    }
+#endif
+    for (; i < num_bytes; i += Width)
+    {
+        word_t w;
+        std::memcpy(&w, data + i, Width);
+        w = endian_swap<word_t, word_t>(w);
+        std::memcpy(data + i, &w, Width);
     }
-
-    *dest = value;
-    return stride;
-}
-
-inline size_t read_property_binary(const size_t & stride, void * dest, size_t & destOffset, std::istream & is)
-{
-    destOffset += stride;
-    fast_read(is, (char*)dest, stride);
-    return stride;
 }
 
-inline size_t read_property_ascii(const Type & t, const size_t & stride, void * dest, size_t & destOffset, std::istream & is)
+inline void endian_swap_buffer(uint8_t * data_ptr, const size_t num_bytes, const size_t stride) noexcept
 {
-    destOffset += stride;
-    switch (t)
+    switch (stride)
     {
-    case Type::INT8:       *((int8_t*)dest) = static_cast<int8_t>(ply_read_ascii<int32_t>(is));    break;
-    case Type::UINT8:      *((uint8_t*)dest) = static_cast<uint8_t>(ply_read_ascii<uint32_t>(is)); break;
-    case Type::INT16:      ply_cast_ascii<int16_t>(dest, is);  break;
-    case Type::UINT16:     ply_cast_ascii<uint16_t>(dest, is); break;
-    case Type::INT32:      ply_cast_ascii<int32_t>(dest, is);  break;
-    case Type::UINT32:     ply_cast_ascii<uint32_t>(dest, is); break;
-    case Type::FLOAT32:    ply_cast_ascii<float>(dest, is);    break;
-    case Type::FLOAT64:    ply_cast_ascii<double>(dest, is);   break;
-    case Type::INVALID:    throw std::invalid_argument("invalid ply property");
+    case 2: byte_swap_items<2>(data_ptr, num_bytes / 2); break;
+    case 4: byte_swap_items<4>(data_ptr, num_bytes / 4); break;
+    case 8: byte_swap_items<8>(data_ptr, num_bytes / 8); break;
+    default: break;
     }
-    return stride;
+}
+inline void fast_read(std::istream & is, char * dest, std::streamsize count)
+{
+    if (is.rdbuf()->sgetn(dest, count) != count) throw std::runtime_error("failed to read binary data (unexpected EOF or stream error)");
 }
 
-struct PlyFile::PlyFileImpl
+namespace io
 {
-    struct PlyDataCursor
+    // Binary payloads are consumed through a byte source. `stream_source` wraps a std::istream, while
+    // `span_source` walks a raw pointer over an in-memory or memory-mapped payload: reads are a memcpy,
+    // skips are a pointer bump, and bulk reads hand back a pointer into the payload instead of a copy.
+    struct stream_source
     {
-        size_t byteOffset{ 0 };
-        size_t totalSizeBytes{ 0 };
-    };
+        std::istream & is;
+        const std::streampos start;
 
-    struct ParsingHelper
-    {
-        std::shared_ptr<PlyData> data;
-        std::shared_ptr<PlyDataCursor> cursor;
-        uint32_t list_size_hint;
-        std::vector<size_t> temp_list_sizes; // collect during first pass
-    };
+        explicit stream_source(std::istream & is) : is(is), start(is.tellg()) {}
 
-    struct PropertyLookup
-    {
-        ParsingHelper * helper{ nullptr };
-        bool skip{ false };
-        size_t prop_stride{ 0 }; // precomputed
-        size_t list_stride{ 0 }; // precomputed
-    };
+        void read(uint8_t * dest, const size_t count) { fast_read(is, reinterpret_cast<char*>(dest), count); }
 
-    struct ElementLayoutInfo
-    {
-        bool is_fixed_layout{ false }; // row stride is known (no variable-length lists)
-        bool fast_path_eligible{ false }; // bulk read possible (all props requested AND is_fixed_layout)
-        size_t row_stride{ 0 };
-        std::vector<size_t> property_offsets;
-        std::vector<size_t> property_sizes;
-    };
+        void skip(const size_t count)
+        {
+            is.ignore(count);
+            if (is.fail() || static_cast<size_t>(is.gcount()) != count) throw std::runtime_error("failed to skip binary data (unexpected EOF or stream error)");
+        }
 
-    std::unordered_map<uint32_t, ParsingHelper> userData;
+        // Returns `count` contiguous bytes, using `staging` as backing storage
+        const uint8_t * view(const size_t count, std::vector<uint8_t> & staging)
+        {
+            staging.resize(count);
+            read(staging.data(), count);
+            return staging.data();
+        }
 
-    bool isBinary = false;
-    bool isBigEndian = false;
-    std::vector<PlyElement> elements;
-    std::vector<std::string> comments;
-    std::vector<std::string> objInfo;
-    uint8_t scratch[64]; // large enough for max list size
+        void rewind() { is.seekg(start, is.beg); }
+    };
 
-    // Cached parsing state (computed once, reused between passes)
-    std::vector<std::vector<PropertyLookup>> cached_property_lut;
-    std::vector<std::vector<std::pair<size_t, size_t>>> cached_batches; // {start_idx, batch_size}
-    std::vector<ElementLayoutInfo> cached_layouts;
-    bool parsing_state_cached{ false };
+    struct span_source
+    {
+        const uint8_t * const begin;
+        const uint8_t * cursor;
+        const uint8_t * const end;
 
-    void ensure_parsing_state_cached();
-    void read(std::istream & is);
-    void write(std::ostream & os, bool isBinary);
+        span_source(const uint8_t * data, const size_t size) : begin(data), cursor(data), end(data + size) {}
 
-    std::shared_ptr<PlyData> request_properties_from_element(const std::string & elementKey,
-        const std::vector<std::string> propertyKeys,
-        const uint32_t list_size_hint);
+        const uint8_t * consume(const size_t count, const char * error)
+        {
+            if (count > static_cast<size_t>(end - cursor)) throw std::runtime_error(error);
+            const uint8_t * ptr = cursor;
+            cursor += count;
+            return ptr;
+        }
 
-    void add_properties_to_element(const std::string & elementKey,
-        const std::vector<std::string> propertyKeys,
-        const Type type, const size_t count, const uint8_t * data, const Type listType, const size_t listCount);
+        void read(uint8_t * dest, const size_t count) { std::memcpy(dest, consume(count, "failed to read binary data (unexpected EOF or stream error)"), count); }
+        void skip(const size_t count) { consume(count, "failed to skip binary data (unexpected EOF or stream error)"); }
+        const uint8_t * view(const size_t count, std::vector<uint8_t> &) { return consume(count, "failed to read binary data (unexpected EOF or stream error)"); }
+        void rewind() { cursor = begin; }
+    };
 
-    std::vector<std::vector<PropertyLookup>> make_property_lookup_table();
+    // The classic locale's whitespace: space, \t, \n, \v, \f and \r
+    inline bool is_space(const char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
 
-    size_t compute_batch_size(const std::vector<PropertyLookup> & lookups,
-        const std::vector<PlyProperty> & properties, size_t start_idx) const;
+#if defined(TINYPLY_SSE2)
+    // Ascii bytes are classified a block at a time: bit i of a mask describes byte i of the block
+#if defined(TINYPLY_AVX2)
+    static const size_t ascii_block = 32;
+    static const uint32_t ascii_block_bits = 0xffffffffu;
 
-    ElementLayoutInfo check_fastpath(const PlyElement & element,
-        const std::vector<PropertyLookup> & lookups) const;
+    inline uint32_t space_mask(const char * p)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        const __m256i controls = _mm256_sub_epi8(v, _mm256_set1_epi8('\t')); // \t..\r become 0..4
+        const __m256i is_control = _mm256_cmpeq_epi8(_mm256_min_epu8(controls, _mm256_set1_epi8(4)), controls);
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_control, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')))));
+    }
 
-    bool parse_header(std::istream & is);
+    inline uint32_t newline_mask(const char * p)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))));
+    }
+#else
+    static const size_t ascii_block = 16;
+    static const uint32_t ascii_block_bits = 0xffffu;
 
-    void parse_data(std::istream & is, bool firstPass);
+    inline uint32_t space_mask(const char * p)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        const __m128i controls = _mm_sub_epi8(v, _mm_set1_epi8('\t')); // \t..\r become 0..4
+        const __m128i is_control = _mm_cmpeq_epi8(_mm_min_epu8(controls, _mm_set1_epi8(4)), controls);
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(is_control, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')))));
+    }
 
-    template <bool is_binary, bool first_pass, bool is_big_endian>
-    void parse_data_impl(std::istream & is);
+    inline uint32_t newline_mask(const char * p)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))));
+    }
+#endif
 
-    void read_header_format(std::istream & is);
-    void read_header_element(std::istream & is);
-    void read_header_property(std::istream & is);
-    void read_header_text(std::string line, std::vector<std::string> & place, int erase = 0);
+    // Whitespace bits of the 64 bytes at `p`
+    inline uint64_t space_bits(const char * p)
+    {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < 64; i += ascii_block) bits |= static_cast<uint64_t>(space_mask(p + i)) << i;
+        return bits;
+    }
+#endif
 
-    void write_header(std::ostream & os) noexcept;
-    void write_ascii_internal(std::ostream & os) noexcept;
-    void write_binary_internal(std::ostream & os) noexcept;
-    void write_property_ascii(Type t, std::ostream & os, const uint8_t * src, size_t & srcOffset);
-    void write_property_binary(std::ostream & os, const uint8_t * src, size_t & srcOffset, const size_t & stride) noexcept;
-};
+    // Index of the lowest set bit of a non-zero mask
+    inline uint32_t lowest_bit(const uint64_t mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        if (_BitScanForward(&index, static_cast<uint32_t>(mask))) return static_cast<uint32_t>(index);
+        _BitScanForward(&index, static_cast<uint32_t>(mask >> 32));
+        return static_cast<uint32_t>(index) + 32;
+#else
+        return static_cast<uint32_t>(__builtin_ctzll(mask));
+#endif
+    }
 
-namespace io
-{
-    template <bool is_binary, bool big_endian>
-    struct property_io;
+    // Number of set bits of a mask
+    inline size_t bit_count(uint64_t mask)
+    {
+#if defined(_MSC_VER)
+        mask = mask - ((mask >> 1) & 0x5555555555555555ull);
+        mask = (mask & 0x3333333333333333ull) + ((mask >> 2) & 0x3333333333333333ull);
+        mask = (mask + (mask >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return static_cast<size_t>((mask * 0x0101010101010101ull) >> 56);
+#else
+        return static_cast<size_t>(__builtin_popcountll(mask));
+#endif
+    }
 
-    // Unified binary specialization for both little and big endian
-    template <bool big_endian>
-    struct property_io<true, big_endian>
+    // Ascii payloads are tokenized straight out of a byte buffer: the in-memory payload itself, or chunks of
+    // a stream. A stream chunk always ends on whitespace (a token cut by the chunk boundary is held back for
+    // the next refill), so every token between `cursor` and `end` is complete.
+    struct ascii_source
     {
-        static inline size_t read(const PlyFile::PlyFileImpl::PropertyLookup & f, const PlyProperty & p, uint8_t * dest, size_t & dest_off, std::istream & is, uint32_t & list_size, size_t & dummy_count, size_t batch_read)
+        std::istream * is{ nullptr };
+        std::streampos start;
+        std::vector<char> chunk;
+        const char * begin{ nullptr };
+        const char * cursor{ nullptr };
+        const char * end{ nullptr };
+        const char * filled{ nullptr }; // end of the bytes read so far; [end, filled) is held back
+        bool eof{ true };
+        const char * block{ nullptr };  // SIMD builds: the last 64 bytes classified at once...
+        uint64_t block_spaces{ 0 };     // ...with bit i set if block[i] is whitespace
+
+        explicit ascii_source(std::istream & is) : is(&is), start(is.tellg()), chunk(size_t(64) << 10) { reset(); }
+
+        ascii_source(const uint8_t * data, const size_t size)
+            : begin(reinterpret_cast<const char*>(data)), cursor(begin), end(begin + size), filled(end) {}
+
+        // Returns the first byte from `p` that is whitespace (`Space`) or that is not, or `end`. Tokens are short,
+        // so the whitespace of a block is classified once and reused by the tokens that follow within it.
+        template <bool Space>
+        const char * find(const char * p)
         {
-            if (p.isList)
+            if (p != end && is_space(*p) == Space) return p;
+            if (!Space && end - p > 1 && !is_space(p[1])) return p + 1; // the usual single separator
+#if defined(TINYPLY_SSE2)
+            for (;;)
             {
-                read_list_count_binary(p.listType, f.list_stride, &list_size, dummy_count, is, big_endian);
-                if (f.helper) validate_list_hint(list_size, f.helper->list_size_hint);
-                return read_property_binary(f.prop_stride * list_size, dest + dest_off, dest_off, is);
+                if (block && p >= block && p < block + 64)
+                {
+                    const uint64_t bits = (Space ? block_spaces : ~block_spaces) >> (p - block);
+                    if (bits) return p + lowest_bit(bits);
+                    p = block + 64;
+                }
+                if (end - p < 64) break;
+                block = p;
+                block_spaces = space_bits(p);
             }
-            return read_property_binary(f.prop_stride * batch_read, dest + dest_off, dest_off, is);
+#endif
+            while (p != end && is_space(*p) != Space) ++p;
+            return p;
         }
 
-        static inline size_t skip(const PlyFile::PlyFileImpl::PropertyLookup & f, const PlyProperty & p, std::istream & is, uint32_t & list_size, size_t & dummy_count, size_t batch_read)
+        // Skips whitespace and returns the start of the next token, or `end` once the input is exhausted
+        const char * token()
         {
-            if (p.isList)
+            for (;;)
             {
-                // Use safe list count reading that validates stride and handles endianness
-                read_list_count_binary(p.listType, f.list_stride, &list_size, dummy_count, is, big_endian);
-                const size_t bytes = f.prop_stride * list_size;
-                is.ignore(bytes);
-                if (is.fail()) throw std::runtime_error("failed to skip binary data (unexpected EOF or stream error)");
-                return bytes;
+                cursor = find<false>(cursor);
+                if (cursor != end || !refill()) return cursor;
             }
-            is.ignore(f.prop_stride * batch_read);
-            if (is.fail()) throw std::runtime_error("failed to skip binary data (unexpected EOF or stream error)");
-            return f.prop_stride * batch_read;
         }
-    };
 
-    // ascii specialization
-    template <>
-    struct property_io<false, false>
-    {
-        static inline size_t read(const PlyFile::PlyFileImpl::PropertyLookup & f, const PlyProperty & p, uint8_t * dest, size_t & dest_off, std::istream & is, uint32_t & list_size, size_t & dummy_count, size_t batch_read)
+        // Steps over the next token; false once the input is exhausted
+        bool skip_token()
         {
-            if (p.isList)
-            {
-                read_property_ascii(p.listType, f.list_stride, &list_size, dummy_count, is);
-                if (f.helper) validate_list_hint(list_size, f.helper->list_size_hint);
-                for (size_t i = 0; i < list_size; ++i) read_property_ascii(p.propertyType, f.prop_stride, dest + dest_off, dest_off, is);
-                return f.prop_stride * list_size;
-            }
-            for (size_t i = 0; i < batch_read; ++i)
-                read_property_ascii(p.propertyType, f.prop_stride, dest + dest_off, dest_off, is);
-            return f.prop_stride * batch_read;
+            const char * p = token();
+            if (p == end) return false;
+            cursor = find<true>(p);
+            return true;
         }
 
-        static inline size_t skip(const PlyFile::PlyFileImpl::PropertyLookup & f, const PlyProperty & p, std::istream & is, uint32_t & list_size, size_t & dummy_count, size_t batch_read)
+        // Steps over the next `n` tokens without converting them; false once the input is exhausted. Runs of
+        // tokens are counted 64 bytes at a time from the whitespace mask, so skipping the rest of a row (or a
+        // whole element) costs little more than classifying its bytes.
+        bool skip_tokens(size_t n)
         {
-            std::string junk;
-            if (p.isList)
+#if defined(TINYPLY_SSE2)
+            while (n > 1)
             {
-                read_property_ascii(p.listType, f.list_stride, &list_size, dummy_count, is);
-                for (size_t i = 0; i < list_size; ++i)
+                const char * p = token();
+                if (p == end) return false;
+                if (end - p < 64) break;
+                if (block != p)
                 {
-                    is >> junk;
-                    if (is.fail()) throw std::runtime_error("failed to skip ascii property value");
+                    block = p;
+                    block_spaces = space_bits(p);
                 }
-                return f.prop_stride * list_size;
+                uint64_t starts = ~block_spaces & ((block_spaces << 1) | 1);
+                const size_t count = bit_count(starts);
+                if (count > n)
+                {
+                    for (; n; --n) starts &= starts - 1;
+                    cursor = p + lowest_bit(starts);
+                    return true;
+                }
+                n -= count;
+                cursor = p + 64;
+                if (!(block_spaces >> 63)) cursor = find<true>(cursor); // a token cut by the block boundary
+            }
+#endif
+            for (; n; --n)
+            {
+                if (!skip_token()) return false;
             }
+            return true;
+        }
 
-            // Skip batch_read values for batched non-list properties
-            for (size_t i = 0; i < batch_read; ++i)
+        void rewind()
+        {
+            if (!is)
             {
-                is >> junk;
-                if (is.fail()) throw std::runtime_error("failed to skip ascii property value");
+                cursor = begin;
+                return;
             }
-            return f.prop_stride * batch_read;
+            is->clear();
+            is->seekg(start, is->beg);
+            reset();
+        }
+
+        void reset()
+        {
+            eof = false;
+            begin = cursor = end = filled = chunk.data();
+            block = nullptr;
+        }
 
+        // Moves the unconsumed bytes to the front of the chunk and reads more of the stream behind them,
+        // growing the chunk for tokens longer than half of it. False if no complete token became available.
+        bool refill()
+        {
+            for (;;)
+            {
+                if (eof)
+                {
+                    end = filled;
+                    return cursor != end;
+                }
+                const size_t offset = cursor - chunk.data(), kept = filled - cursor;
+                if (kept >= chunk.size() / 2) chunk.resize(chunk.size() * 2);
+                char * data = chunk.data();
+                std::memmove(data, data + offset, kept);
+                const size_t wanted = chunk.size() - kept;
+                const size_t got = static_cast<size_t>(is->rdbuf()->sgetn(data + kept, static_cast<std::streamsize>(wanted)));
+                eof = got < wanted;
+                begin = cursor = data;
+                end = filled = data + kept + got;
+                block = nullptr;
+                if (!eof) while (end != cursor && !is_space(end[-1])) --end;
+                if (end != cursor) return true;
+            }
         }
     };
 
-} // end namespace io
+    // Returns the position after the newline that ends the line at `p`, or `end`
+    inline const char * line_end(const char * p, const char * end)
+    {
+        const char * newline = static_cast<const char *>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        return newline ? newline + 1 : end;
+    }
 
-PlyProperty::PlyProperty(std::istream & is) : isList(false)
-{
-    std::string type;
-    is >> type;
-    if (type == "list")
+    // Counts the rows of an ascii payload in [p, end), taking a row to be a line with a token, and returns the
+    // position after the line of row `max_rows` (or `end`)
+    inline const char * scan_ascii_rows(const char * p, const char * end, size_t & rows, const size_t max_rows)
     {
-        std::string countType;
-        is >> countType >> type;
-        listType = property_type_from_string(countType);
-        isList = true;
+        size_t found = 0;
+        bool token = false; // the current line has a token
+#if defined(TINYPLY_SSE2)
+        for (; static_cast<size_t>(end - p) >= ascii_block; p += ascii_block)
+        {
+            uint32_t newlines = newline_mask(p);
+            uint32_t tokens = ~space_mask(p) & ascii_block_bits;
+            while (newlines)
+            {
+                const uint32_t newline = newlines & (0u - newlines);
+                const uint32_t line = newline | (newline - 1); // the rest of the line, up to its newline
+                if ((token || (tokens & line)) && ++found == max_rows)
+                {
+                    rows += found;
+                    return p + lowest_bit(newlines) + 1;
+                }
+                token = false;
+                tokens &= ~line;
+                newlines &= ~line;
+            }
+            token = token || tokens;
+        }
+#endif
+        for (; p != end; ++p)
+        {
+            if (*p != '\n')
+            {
+                token = token || !is_space(*p);
+                continue;
+            }
+            if (token && ++found == max_rows)
+            {
+                rows += found;
+                return p + 1;
+            }
+            token = false;
+        }
+        if (token) ++found;
+        rows += found;
+        return p;
     }
-    propertyType = property_type_from_string(type);
-    is >> name;
-}
 
-PlyElement::PlyElement(std::istream & is)
+    // Read-only, seekable streambuf over a span of bytes. Used to run the istream-based header
+    // and ascii parsers over in-memory data without copying it.
+    struct span_streambuf : public std::streambuf
+    {
+        span_streambuf(const uint8_t * data, const size_t size)
+        {
+            char * p = const_cast<char*>(reinterpret_cast<const char*>(data));
+            setg(p, p, p + size);
+        }
+
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) override
+        {
+            char * base = (dir == std::ios_base::beg) ? eback() : (dir == std::ios_base::cur) ? gptr() : egptr();
+            if (off < eback() - base || off > egptr() - base) return pos_type(off_type(-1));
+            setg(eback(), base + off, egptr());
+            return pos_type(gptr() - eback());
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+        {
+            return seekoff(off_type(pos), std::ios_base::beg, which);
+        }
+    };
+
+    // Read-only memory mapping of an entire file. The kernel is hinted that the mapping
+    // will be read front-to-back, soon, so readahead can run ahead of the parser.
+    class mapped_file
+    {
+        const uint8_t * ptr{ nullptr };
+        size_t length{ 0 };
+#if defined(_WIN32)
+        HANDLE file{ INVALID_HANDLE_VALUE };
+        HANDLE mapping{ nullptr };
+#endif
+        mapped_file(const mapped_file &) = delete;
+        mapped_file & operator=(const mapped_file &) = delete;
+
+    public:
+        const std::string path;
+
+        explicit mapped_file(const std::string & filepath) : path(filepath)
+        {
+#if defined(_WIN32)
+            file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("failed to open file: " + filepath);
+            LARGE_INTEGER file_size;
+            if (!GetFileSizeEx(file, &file_size)) { CloseHandle(file); throw std::runtime_error("failed to query file size: " + filepath); }
+            length = static_cast<size_t>(file_size.QuadPart);
+            if (length == 0) return;
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) ptr = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            if (!ptr)
+            {
+                if (mapping) CloseHandle(mapping);
+                CloseHandle(file);
+                throw std::runtime_error("failed to memory-map file: " + filepath);
+            }
+#else
+            const int fd = ::open(filepath.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error("failed to open file: " + filepath);
+            struct stat st;
+            if (::fstat(fd, &st) != 0) { ::close(fd); throw std::runtime_error("failed to query file size: " + filepath); }
+            length = static_cast<size_t>(st.st_size);
+            if (length == 0) { ::close(fd); return; }
+            void * addr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd); // the mapping holds its own reference to the file
+            if (addr == MAP_FAILED) throw std::runtime_error("failed to memory-map file: " + filepath);
+            ptr = static_cast<const uint8_t*>(addr);
+    #if defined(MADV_SEQUENTIAL) && defined(MADV_WILLNEED)
+            ::madvise(addr, length, MADV_SEQUENTIAL);
+            ::madvise(addr, length, MADV_WILLNEED);
+    #endif
+#endif
+        }
+
+        ~mapped_file()
+        {
+#if defined(_WIN32)
+            if (ptr) UnmapViewOfFile(ptr);
+            if (mapping) CloseHandle(mapping);
+            if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+            if (ptr) ::munmap(const_cast<uint8_t*>(ptr), length);
+#endif
+        }
+
+        const uint8_t * data() const { return ptr; }
+        size_t size() const { return length; }
+    };
+
+    // Returns the offset of the first payload byte, i.e. just past the `end_header` line.
+    inline size_t find_payload_offset(const uint8_t * data, const size_t size)
+    {
+        static const char token[] = "end_header";
+        const size_t token_len = sizeof(token) - 1;
+        size_t line_start = 0;
+        while (line_start < size)
+        {
+            const uint8_t * eol = static_cast<const uint8_t*>(std::memchr(data + line_start, '\n', size - line_start));
+            const size_t line_end = eol ? static_cast<size_t>(eol - data) : size;
+            size_t i = line_start;
+            while (i < line_end && (data[i] == ' ' || data[i] == '\t')) ++i;
+            if (line_end - i >= token_len && std::memcmp(data + i, token, token_len) == 0)
+            {
+                size_t j = i + token_len;
+                while (j < line_end && std::isspace(data[j])) ++j;
+                if (j == line_end) return eol ? line_end + 1 : size;
+            }
+            line_start = line_end + 1;
+        }
+        throw std::runtime_error("header is malformed: missing end_header");
+    }
+
+    // Size and modification time of a file, which identify the version of it an index was built from
+    inline bool file_stamp(const std::string & filepath, uint64_t & size, int64_t & mtime)
+    {
+#if defined(_WIN32)
+        WIN32_FILE_ATTRIBUTE_DATA attributes;
+        if (!GetFileAttributesExA(filepath.c_str(), GetFileExInfoStandard, &attributes)) return false;
+        size = (static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+        mtime = static_cast<int64_t>((static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime);
+#else
+        struct stat st;
+        if (::stat(filepath.c_str(), &st) != 0) return false;
+        size = static_cast<uint64_t>(st.st_size);
+    #if defined(__APPLE__)
+        mtime = static_cast<int64_t>(st.st_mtimespec.tv_sec) * 1000000000 + st.st_mtimespec.tv_nsec;
+    #else
+        mtime = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    #endif
+#endif
+        return true;
+    }
+
+    // Positions `is` just past the `end_header` line, the stream equivalent of `find_payload_offset`
+    inline void skip_header(std::istream & is)
+    {
+        std::string line;
+        while (std::getline(is, line))
+        {
+            std::istringstream ls(line);
+            std::string token;
+            ls >> token;
+            if (token == "end_header") return;
+        }
+        throw std::runtime_error("header is malformed: missing end_header");
+    }
+
+} // end namespace io
+
+inline void validate_list_hint(uint32_t actual, uint32_t hint)
+{
+    if (hint > 0 && actual != hint)
+        throw std::runtime_error("list_size_hint mismatch: hint=" + std::to_string(hint) +
+            ", actual=" + std::to_string(actual) + ". Use list_size_hint=0 for variable-length lists.");
+}
+
+template <typename Source>
+inline size_t read_list_count_binary(const Type & t, const size_t& stride, uint32_t * dest, size_t & destOffset, Source & src, bool be)
+{
+    destOffset += stride;
+
+    // Read into a temporary buffer sized for the largest valid list count type (4 bytes)
+    // This prevents stack buffer overflow if stride > sizeof(uint32_t)
+    uint8_t temp[4] = {0, 0, 0, 0};
+    if (stride > 4) throw std::runtime_error("invalid list count type: stride exceeds 4 bytes (list counts must be integer types");
+
+    src.read(temp, stride);
+
+    // Convert to uint32_t based on source type
+    uint32_t value = 0;
+    switch (t)
+    {
+    case Type::INT8: value = static_cast<uint32_t>(*reinterpret_cast<int8_t*>(temp)); break;
+    case Type::UINT8: value = static_cast<uint32_t>(*reinterpret_cast<uint8_t*>(temp)); break;
+    case Type::INT16: if (be) *reinterpret_cast<int16_t*>(temp) = endian_swap<int16_t, int16_t>(*reinterpret_cast<int16_t*>(temp)); value = static_cast<uint32_t>(*reinterpret_cast<int16_t*>(temp));break;
+    case Type::UINT16: if (be) *reinterpret_cast<uint16_t*>(temp) = endian_swap<uint16_t, uint16_t>(*reinterpret_cast<uint16_t*>(temp)); value = static_cast<uint32_t>(*reinterpret_cast<uint16_t*>(temp)); break;
+    case Type::INT32: if (be) *reinterpret_cast<int32_t*>(temp) = endian_swap<int32_t, int32_t>(*reinterpret_cast<int32_t*>(temp)); value = static_cast<uint32_t>(*reinterpret_cast<int32_t*>(temp)); break;
+    case Type::UINT32: if (be) *reinterpret_cast<uint32_t*>(temp) = endian_swap<uint32_t, uint32_t>(*reinterpret_cast<uint32_t*>(temp)); value = *reinterpret_cast<uint32_t*>(temp); break;
+    default: throw std::runtime_error("invalid list count type: must be an integer type (int8, uint8, int16, uint16, int32, uint32)");
+    }
+
+    *dest = value;
+    return stride;
+}
+
+// Decodes a binary list count stored in the file's byte order (throws for non-integer count types)
+inline uint32_t decode_list_count(const Type t, const uint8_t * data, const size_t stride, const bool be)
+{
+    io::span_source src(data, stride);
+    uint32_t value = 0;
+    size_t offset = 0;
+    read_list_count_binary(t, stride, &value, offset, src, be);
+    return value;
+}
+
+template <typename Source>
+inline size_t read_property_binary(const size_t & stride, void * dest, size_t & destOffset, Source & src)
+{
+    destOffset += stride;
+    src.read(static_cast<uint8_t*>(dest), stride);
+    return stride;
+}
+
+// Fallback for what from_chars cannot decide alone: istream extraction over a copy of the token
+template<typename T> inline const char * parse_ascii_stream(const char * first, const char * last, T & value)
+{
+    const std::string token(first, std::find_if(first, last, io::is_space));
+    std::istringstream is(token);
+    is.imbue(std::locale::classic());
+    is >> value;
+    if (is.fail()) return nullptr;
+    return first + (is.eof() ? token.size() : static_cast<size_t>(is.tellg()));
+}
+
+// Number of leading decimal digits of the 8 bytes in `chunk` (the first byte lowest)
+inline uint32_t count_digits(const uint64_t chunk)
+{
+    // A byte is a digit if its high nibble is 3 both before and after adding 6; carries out of a byte only
+    // come from bytes that are not digits, and so only disturb bytes after the first non-digit.
+    const uint64_t high = 0xf0f0f0f0f0f0f0f0ull, threes = 0x3030303030303030ull;
+    const uint64_t non_digits = ((chunk & high) ^ threes) | (((chunk + 0x0606060606060606ull) & high) ^ threes);
+    return non_digits ? io::lowest_bit(non_digits) / 8 : 8;
+}
+
+// Value of the 8 ascii digits in `chunk` (the first byte lowest), combining pairs, quads and halves in turn
+inline uint32_t swar_digits(uint64_t chunk)
+{
+    chunk &= 0x0f0f0f0f0f0f0f0full;
+    chunk = (chunk * 10 + (chunk >> 8)) & 0x00ff00ff00ff00ffull;
+    chunk = (chunk * 100 + (chunk >> 16)) & 0x0000ffff0000ffffull;
+    return static_cast<uint32_t>(chunk * 10000 + (chunk >> 32));
+}
+
+// Parses the digits at `first` into `magnitude` 8 at a time. Returns one past the last digit, or nullptr if there
+// is none; `overflow` is set past 32 significant bits.
+inline const char * parse_ascii_digits(const char * first, const char * last, uint64_t & magnitude, bool & overflow)
+{
+    const char * p = first;
+    magnitude = 0;
+    overflow = false;
+    for (;;)
+    {
+        uint32_t digits;
+        uint64_t value;
+        if (last - p >= 8)
+        {
+            uint64_t chunk;
+            std::memcpy(&chunk, p, 8);
+            digits = count_digits(chunk);
+            if (!digits) break;
+            value = swar_digits(chunk << (8 * (8 - digits))); // leading zero bytes read as zeros
+        }
+        else
+        {
+            for (digits = 0, value = 0; p + digits != last && p[digits] >= '0' && p[digits] <= '9'; ++digits)
+                value = value * 10 + static_cast<uint32_t>(p[digits] - '0');
+            if (!digits) break;
+        }
+        static const uint64_t scale[9] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+        if (!overflow) magnitude = magnitude * scale[digits] + value;
+        overflow = overflow || magnitude > 0xffffffffull;
+        p += digits;
+        if (digits < 8) break;
+    }
+    return p == first ? nullptr : p;
+}
+
+// Parses the value at `first` exactly like `std::istream >> T` in the classic locale: a leading '+' is accepted,
+// unsigned types wrap negative values, and parsing stops at the first character that cannot continue the number
+// (the next value starts there). Returns one past the parsed characters, or nullptr if there is no value.
+template<typename T> inline const char * parse_ascii(const char * first, const char * last, T & value)
+{
+    if (first != last && *first == '+')
+    {
+        if (++first != last && *first == '-') return nullptr;
+    }
+
+    if constexpr (std::is_floating_point<T>::value)
+    {
+        // from_chars also accepts "inf" and "nan", which istream extraction rejects
+        const char * digits = first + (first != last && *first == '-');
+        if (digits == last || !((*digits >= '0' && *digits <= '9') || *digits == '.')) return nullptr;
+#if defined(__cpp_lib_to_chars)
+        const auto result = std::from_chars(first, last, value);
+        if (result.ec == std::errc())
+        {
+            // istream extraction consumes an exponent marker without digits and then fails on it
+            const auto is_exponent = [](const char c) { return c == 'e' || c == 'E'; };
+            if (result.ptr != last && is_exponent(*result.ptr) && std::none_of(first, result.ptr, is_exponent)) return nullptr;
+            return result.ptr;
+        }
+        if (result.ec != std::errc::result_out_of_range) return nullptr;
+#endif
+        // Out of range, where istream extraction still accepts underflow to zero or a denormal
+        return parse_ascii_stream(first, last, value);
+    }
+    else if constexpr (sizeof(T) <= 4)
+    {
+        const bool negative = first != last && *first == '-';
+        const char * digits = first + negative;
+        uint64_t magnitude;
+        const char * next;
+
+        // Ascii face lists are mostly short values, which fit one 8-byte load without further checks
+        uint64_t chunk;
+        uint32_t count = 0;
+        if (last - digits >= 8)
+        {
+            std::memcpy(&chunk, digits, 8);
+            count = count_digits(chunk);
+        }
+        if (count - 1 < 7)
+        {
+            magnitude = swar_digits(chunk << (8 * (8 - count))); // leading zero bytes read as zeros
+            next = digits + count;
+        }
+        else
+        {
+            bool overflow;
+            next = parse_ascii_digits(digits, last, magnitude, overflow);
+            if (!next || overflow) return nullptr;
+        }
+        if constexpr (std::is_unsigned<T>::value)
+        {
+            if (magnitude > (std::numeric_limits<T>::max)()) return nullptr;
+            value = static_cast<T>(negative ? T(0) - static_cast<T>(magnitude) : static_cast<T>(magnitude));
+        }
+        else
+        {
+            const uint64_t limit = static_cast<uint64_t>((std::numeric_limits<T>::max)()) + negative;
+            if (magnitude > limit) return nullptr;
+            value = static_cast<T>(negative ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude));
+        }
+        return next;
+    }
+    else
+    {
+        if constexpr (std::is_unsigned<T>::value)
+        {
+            if (first != last && *first == '-')
+            {
+                T magnitude;
+                const auto result = std::from_chars(first + 1, last, magnitude);
+                if (result.ec != std::errc()) return nullptr;
+                value = static_cast<T>(T(0) - magnitude);
+                return result.ptr;
+            }
+        }
+        const auto result = std::from_chars(first, last, value);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+    }
+}
+
+template<typename T> inline T ply_read_ascii(io::ascii_source & src)
+{
+    T data;
+    const char * first = src.token(); // may refill, which moves `end`
+    const char * next = parse_ascii(first, src.end, data);
+    if (!next)
+        throw std::runtime_error("failed to read ascii property value");
+    if (std::is_floating_point<T>::value && std::isnan(static_cast<double>(data)))
+        throw std::runtime_error("NaN values are not supported in ascii PLY files");
+    src.cursor = next;
+    return data;
+}
+
+template<typename T> inline void ply_cast_ascii(void* dest, io::ascii_source & src)
+{
+    *(static_cast<T*>(dest)) = ply_read_ascii<T>(src);
+}
+
+inline size_t read_property_ascii(const Type & t, const size_t & stride, void * dest, size_t & destOffset, io::ascii_source & src)
+{
+    destOffset += stride;
+    switch (t)
+    {
+    case Type::INT8:       *((int8_t*)dest) = static_cast<int8_t>(ply_read_ascii<int32_t>(src));    break;
+    case Type::UINT8:      *((uint8_t*)dest) = static_cast<uint8_t>(ply_read_ascii<uint32_t>(src)); break;
+    case Type::INT16:      ply_cast_ascii<int16_t>(dest, src);  break;
+    case Type::UINT16:     ply_cast_ascii<uint16_t>(dest, src); break;
+    case Type::INT32:      ply_cast_ascii<int32_t>(dest, src);  break;
+    case Type::UINT32:     ply_cast_ascii<uint32_t>(dest, src); break;
+    case Type::FLOAT32:    ply_cast_ascii<float>(dest, src);    break;
+    case Type::FLOAT64:    ply_cast_ascii<double>(dest, src);   break;
+    case Type::INVALID:    throw std::invalid_argument("invalid ply property");
+    }
+    return stride;
+}
+
+struct PlyFile::PlyFileImpl
+{
+    struct PlyDataCursor
+    {
+        size_t byteOffset{ 0 };
+        size_t totalSizeBytes{ 0 };
+    };
+
+    struct ParsingHelper
+    {
+        std::shared_ptr<PlyData> data;
+        std::shared_ptr<PlyDataCursor> cursor;
+        uint32_t list_size_hint;
+        bool zero_copy{ false };
+        std::vector<size_t> temp_list_sizes; // per-row counts of a variable-length list, collected while parsing
+        bool auto_list_size{ false };        // requested with `auto_list_size_hint` (`list_size_hint` stays 0)
+        uint32_t speculative_list_size{ 0 }; // auto lists: the size the leading rows agree on...
+        size_t speculative_rows{ 0 };        // ...and how many rows have it (0 once recorded per row)
+        bool list_offsets{ false };
+        bool triangulate{ false }; // lists are turned into triangles: fans of polygons, or strips with `tristrips`
+        bool tristrips{ false };
+        bool face_map{ false };
+        size_t num_rows{ 0 }; // rows of the element; `data->count` becomes the number of triangles when triangulating
+        size_t rows_read{ 0 }; // rows the buffer was last filled with (differs from `num_rows` after `read_rows`)
+        std::vector<uint8_t> strip_items; // tristrips: the row's strips, read back while its triangles overwrite them
+        std::vector<uint32_t> temp_list_offsets; // list_offsets requests: running totals (from 0) instead of `temp_list_sizes`
+
+        size_t recorded_lists() const
+        {
+            return temp_list_sizes.size() + (temp_list_offsets.empty() ? 0 : temp_list_offsets.size() - 1);
+        }
+
+        // Records `num_rows` more lists of `list_size` items, as running totals while they fit in 32 bits
+        void record_lists(const size_t num_rows, const size_t list_size)
+        {
+            if (list_offsets && temp_list_sizes.empty())
+            {
+                if (temp_list_offsets.empty())
+                {
+                    temp_list_offsets.reserve(data->count + 1);
+                    temp_list_offsets.push_back(0);
+                }
+                if (temp_list_offsets.back() + static_cast<uint64_t>(num_rows) * list_size <= 0xffffffffu)
+                {
+                    for (size_t i = 0; i < num_rows; ++i) temp_list_offsets.push_back(temp_list_offsets.back() + static_cast<uint32_t>(list_size));
+                    return;
+                }
+                for (size_t i = 1; i < temp_list_offsets.size(); ++i) temp_list_sizes.push_back(temp_list_offsets[i] - temp_list_offsets[i - 1]);
+                temp_list_offsets.clear();
+                temp_list_offsets.shrink_to_fit();
+            }
+            temp_list_sizes.insert(temp_list_sizes.end(), num_rows, list_size);
+        }
+
+        // Adds `num_rows` more rows with lists of `list_size` items. Auto-sized lists only count rows while they
+        // agree; the first disagreeing row expands the count into per-row sizes and the list continues as
+        // variable-length.
+        void append_lists(const size_t num_rows, const uint32_t list_size)
+        {
+            if (auto_list_size && recorded_lists() == 0 && (speculative_rows == 0 || speculative_list_size == list_size))
+            {
+                speculative_list_size = list_size;
+                speculative_rows += num_rows;
+            }
+            else
+            {
+                if (speculative_rows) record_lists(speculative_rows, speculative_list_size);
+                speculative_rows = 0;
+                record_lists(num_rows, list_size);
+            }
+        }
+
+        // Appends the lists of `other`, which recorded the rows that follow the ones recorded here
+        void append_lists(const ParsingHelper & other)
+        {
+            if (other.speculative_rows) append_lists(other.speculative_rows, other.speculative_list_size);
+            const size_t n = other.recorded_lists();
+            auto list = [&](const size_t i) { return static_cast<uint32_t>(other.temp_list_sizes.empty() ? other.temp_list_offsets[i + 1] - other.temp_list_offsets[i] : other.temp_list_sizes[i]); };
+            for (size_t i = 0, run = 1; i < n; i += run)
+            {
+                for (run = 1; i + run < n && list(i + run) == list(i); ++run) {}
+                append_lists(run, list(i));
+            }
+        }
+    };
+
+    struct PropertyLookup
+    {
+        ParsingHelper * helper{ nullptr };
+        bool skip{ false };
+        size_t prop_stride{ 0 }; // precomputed
+        size_t list_stride{ 0 }; // precomputed
+    };
+
+    struct ElementLayoutInfo
+    {
+        bool is_fixed_layout{ false }; // row stride is known (no variable-length lists)
+        bool fast_path_eligible{ false }; // bulk read possible (is_fixed_layout; skipped props are stepped over in the staged rows)
+        bool skip_element{ false }; // nothing requested and is_fixed_layout (ascii: no lists): step over all rows at once
+        bool direct_read{ false }; // one group owns every (non-list) property: rows are already in destination order
+        size_t row_stride{ 0 };
+        std::vector<size_t> property_offsets;
+        std::vector<size_t> property_sizes;
+
+        struct ZeroCopyView
+        {
+            PlyData * data;
+            size_t row_offset; // offset of the group's first property within a row
+            size_t row_bytes;  // bytes per row covered by the group
+        };
+        std::vector<ZeroCopyView> views;
+    };
+
+    // One contiguous run of requested bytes in a source row and where it lands in its group's buffer
+    struct ScatterColumn;
+    typedef void (*ScatterKernel)(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows);
+    struct ScatterColumn
+    {
+        size_t src_offset{ 0 };   // offset within a source row
+        size_t size{ 0 };         // bytes copied per row
+        uint8_t * dst{ nullptr }; // destination of the first row
+        size_t dst_stride{ 0 };   // destination bytes per row (the group's row size)
+        size_t count_offset{ 0 }; // fixed-size lists only: the count prefix to validate
+        size_t count_stride{ 0 };
+        Type count_type{ Type::INVALID };
+        bool count_big_endian{ false };
+        uint32_t expected_count{ 0 };
+        uint32_t expected_raw{ 0 };   // `expected_count` encoded like the file's count prefix
+        size_t raw_count_stride{ 0 }; // bytes compared against `expected_raw` (0 = decode every count instead)
+        size_t swap_width{ 0 };          // big-endian sources: width of the items to byte-swap while copying
+        size_t fan_items{ 0 };           // triangulated lists only: polygon size, written as `fan_items - 2` triangles
+        ScatterKernel kernel{ nullptr }; // copy loop specialized for `size`, selected once per element
+        size_t lanes{ 1 };               // columns handled by `kernel`: this one and the next `lanes - 1`
+    };
+
+    std::unordered_map<uint32_t, ParsingHelper> userData;
+
+    bool isBinary = false;
+    bool isBigEndian = false;
+    std::vector<PlyElement> elements;
+    std::vector<std::string> comments;
+    std::vector<std::string> objInfo;
+    uint8_t scratch[64]; // large enough for max list size
+    ReadOptions read_options;
+
+    // Cached parsing state (computed once, reused between passes)
+    std::vector<std::vector<PropertyLookup>> cached_property_lut;
+    std::vector<std::vector<std::pair<size_t, size_t>>> cached_batches; // {start_idx, batch_size}
+    std::vector<ElementLayoutInfo> cached_layouts;
+    bool parsing_state_cached{ false };
+
+    std::shared_ptr<io::mapped_file> mapped;
+    std::shared_ptr<const void> source_owner; // lifetime of the in-memory source, shared with zero-copy views
+    bool views_enabled{ false }; // the current source supports zero-copy views
+    bool lists_counted{ false }; // a first pass has recorded the size of every variable-length list
+
+    void ensure_parsing_state_cached();
+    void read(std::istream & is);
+    void read(const uint8_t * data, const size_t size, std::shared_ptr<const void> owner = nullptr);
+    void write(std::ostream & os, bool isBinary);
+
+    template <typename Source>
+    void read_impl(Source & src);
+
+    const io::mapped_file & map_file(const std::string & filepath);
+
+    uint64_t fixed_row_stride(const PlyElement & element) const;
+    uint32_t header_hash() const;
+    template <typename Source>
+    uint64_t skip_rows(const PlyElement & element, Source & src, const size_t num_rows, uint64_t * list_items = nullptr) const;
+    void size_lists_from_index(bool & all_sized);
+    template <typename Seek>
+    ElementIndex index_elements(const uint64_t payload_offset, const uint64_t interval, Seek seek) const;
+    template <typename Seek>
+    void read_rows(const ElementIndex & index, const std::string & elementKey, const size_t begin, const size_t end, Seek seek);
+
+    std::shared_ptr<PlyData> request_properties_from_element(const std::string & elementKey,
+        const std::vector<std::string> propertyKeys,
+        const uint32_t list_size_hint,
+        const RequestOptions & options);
+
+    void add_properties_to_element(const std::string & elementKey,
+        const std::vector<std::string> propertyKeys,
+        const Type type, const size_t count, const uint8_t * data, const Type listType, const size_t listCount);
+
+    std::vector<std::vector<PropertyLookup>> make_property_lookup_table();
+
+    size_t compute_batch_size(const std::vector<PropertyLookup> & lookups,
+        const std::vector<PlyProperty> & properties, size_t start_idx) const;
+
+    ElementLayoutInfo check_fastpath(const PlyElement & element,
+        const std::vector<PropertyLookup> & lookups) const;
+
+    void resolve_zero_copy_views(const PlyElement & element, std::vector<PropertyLookup> & lookups, ElementLayoutInfo & layout);
+
+    std::vector<ScatterColumn> plan_scatter(const PlyElement & element, const std::vector<PropertyLookup> & lookups, const ElementLayoutInfo & layout, const size_t num_rows);
+
+    template <typename Source>
+    void scatter_element(const PlyElement & element, const std::vector<PropertyLookup> & lookups, const ElementLayoutInfo & layout,
+        const size_t num_rows, Source & src, std::vector<uint8_t> & staging);
+
+    template <bool big_endian>
+    size_t speculate_list_sizes(const PlyElement & element, const std::vector<PropertyLookup> & lookups,
+        const std::vector<std::pair<size_t, size_t>> & batches, io::span_source & src, std::vector<uint8_t> & staging);
+
+    static void scatter_rows(const uint8_t * rows, const size_t row_stride, const size_t first_row, const size_t row_begin, const size_t row_end,
+        const std::vector<ScatterColumn> & columns);
+
+    template <size_t Size, size_t Swap>
+    static void scatter_column(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows);
+    static ScatterKernel select_scatter_kernel(const size_t size, const size_t swap);
+    template <size_t Stride, bool Swap>
+    static void scatter_fan(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows);
+    static ScatterKernel select_fan_kernel(const size_t stride, const size_t swap);
+    template <size_t Swap>
+    static ScatterKernel select_swap_kernel(const size_t size);
+    static void select_transpose_kernels(std::vector<ScatterColumn> & columns, const bool stream);
+    static ScatterKernel select_transpose_kernel(const size_t lanes, const size_t width, const bool stream, const bool swap);
+    template <bool Stream, bool Swap>
+    static ScatterKernel select_transpose_kernel(const size_t lanes, const size_t width);
+#if defined(TINYPLY_SSE2)
+    template <bool Stream, bool Swap>
+    static void transpose_4x32(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows);
+    template <bool Stream, bool Swap>
+    static void transpose_2x64(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows);
+#endif
+#if defined(TINYPLY_AVX2)
+    template <bool Stream, bool Swap>
+    static void transpose_8x32(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows);
+    template <bool Stream, bool Swap>
+    static void transpose_4x64(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows);
+#endif
+    static void validate_column(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t num_rows);
+    template <size_t RawStride>
+    static void validate_list_counts(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t num_rows);
+
+    size_t parallel_task_count(const size_t total_bytes) const;
+    void parallel_for(const size_t count, const std::function<void(size_t)> & job);
+
+    bool parse_header(std::istream & is);
+    bool parse_header(const uint8_t * data, const size_t size);
+
+    template <typename Source>
+    void parse_data(Source & src, bool firstPass);
+
+    template <bool is_binary, bool first_pass, bool is_big_endian, typename Source>
+    void parse_data_impl(Source & src);
+
+    template <bool is_binary, bool first_pass, bool is_big_endian, typename Source>
+    void parse_rows(const PlyElement & element, const std::vector<PropertyLookup> & lookups,
+        const std::vector<std::pair<size_t, size_t>> & batches, Source & src, const size_t first_row, const size_t end_row);
+
+    bool parse_ascii_parallel(const PlyElement & element, const std::vector<PropertyLookup> & lookups,
+        const std::vector<std::pair<size_t, size_t>> & batches, io::ascii_source & src);
+
+    void read_header_format(std::istream & is);
+    void read_header_element(std::istream & is);
+    void read_header_property(std::istream & is);
+    void read_header_text(std::string line, std::vector<std::string> & place, int erase = 0);
+
+    void write_header(std::ostream & os) noexcept;
+    void write_ascii_internal(std::ostream & os) noexcept;
+    void write_binary_internal(std::ostream & os) noexcept;
+    void write_property_ascii(Type t, std::ostream & os, const uint8_t * src, size_t & srcOffset);
+    void write_property_binary(std::ostream & os, const uint8_t * src, size_t & srcOffset, const size_t & stride) noexcept;
+};
+
+// Bytes needed in the destination to read a list of `list_size` items, which for triangulated lists is the
+// larger of the polygon itself and the triangles it is expanded into
+inline size_t list_payload_bytes(const PlyFile::PlyFileImpl::ParsingHelper & helper, const size_t list_size, const size_t stride)
+{
+    if (!helper.triangulate) return list_size * stride;
+    return (std::max)(list_size, list_size >= 3 ? 3 * (list_size - 2) : 0) * stride;
+}
+
+// Fans the polygon of `n` indices just read at `items` into the n - 2 triangles (v0, vi, vi+1) in place and
+// returns their size in bytes. Triangles are written back to front, so no index is overwritten before use.
+template <size_t Stride>
+inline size_t fan_triangulate(uint8_t * items, const size_t n)
+{
+    if (n < 3) return 0;
+    uint8_t first[Stride];
+    std::memcpy(first, items, Stride);
+    for (size_t t = n - 2; t-- > 1; )
+    {
+        uint8_t * triangle = items + 3 * t * Stride;
+        std::memmove(triangle + Stride, items + (t + 1) * Stride, 2 * Stride);
+        std::memcpy(triangle, first, Stride);
+    }
+    return 3 * (n - 2) * Stride;
+}
+
+inline size_t fan_triangulate(uint8_t * items, const size_t n, const size_t stride)
+{
+    switch (stride)
+    {
+    case 1: return fan_triangulate<1>(items, n);
+    case 2: return fan_triangulate<2>(items, n);
+    case 4: return fan_triangulate<4>(items, n);
+    case 8: return fan_triangulate<8>(items, n);
+    default: throw std::invalid_argument("invalid ply property");
+    }
+}
+
+// Unrolls the triangle strips of `n` indices just read at `items` into a triangle list in place and returns its
+// size in bytes. A restart index (all bits set) ends a strip; triangles that repeat an index (the joins of
+// stitched strips) are dropped, but still count towards the alternating winding.
+template <size_t Stride>
+inline size_t unroll_strips(uint8_t * items, const size_t n, std::vector<uint8_t> & strip)
+{
+    typedef typename std::conditional<Stride == 1, uint8_t, typename std::conditional<Stride == 2, uint16_t, uint32_t>::type>::type index_t;
+    const index_t restart = static_cast<index_t>(~index_t(0));
+
+    strip.assign(items, items + n * Stride);
+    uint8_t * out = items;
+    index_t a = 0, b = 0;
+    size_t run = 0; // indices of the current strip seen so far
+    for (size_t i = 0; i < n; ++i)
+    {
+        index_t c;
+        std::memcpy(&c, strip.data() + i * Stride, Stride);
+        if (c == restart) { run = 0; continue; }
+        if (run >= 2 && a != b && b != c && a != c)
+        {
+            const index_t triangle[3] = { run & 1 ? b : a, run & 1 ? a : b, c };
+            std::memcpy(out, triangle, 3 * Stride);
+            out += 3 * Stride;
+        }
+        a = b;
+        b = c;
+        ++run;
+    }
+    return static_cast<size_t>(out - items);
+}
+
+// Turns the list of `n` items just read at `items` into triangles in place and returns their size in bytes
+inline size_t triangulate_list(PlyFile::PlyFileImpl::ParsingHelper & helper, uint8_t * items, const size_t n, const size_t stride)
+{
+    if (!helper.tristrips) return fan_triangulate(items, n, stride);
+    switch (stride)
+    {
+    case 1: return unroll_strips<1>(items, n, helper.strip_items);
+    case 2: return unroll_strips<2>(items, n, helper.strip_items);
+    case 4: return unroll_strips<4>(items, n, helper.strip_items);
+    default: throw std::invalid_argument("tristrips requires integer indices");
+    }
+}
+
+// Reallocates the buffer of a list group to `capacity` bytes, keeping the payload before the cursor
+inline void grow_list_buffer(PlyFile::PlyFileImpl::ParsingHelper & helper, const size_t capacity)
+{
+    Buffer & buffer = helper.data->buffer;
+    const size_t used = helper.cursor->byteOffset;
+    Buffer grown(capacity);
+    if (used) std::memcpy(grown.get(), buffer.get(), used);
+    buffer = std::move(grown);
+}
+
+// Makes room for `bytes` more payload after the cursor of a variable-length list and returns the (possibly moved)
+// buffer. Once enough rows have been seen, the whole element is sized by extrapolating their average list, so
+// typical meshes settle after a single large allocation; lists that keep outgrowing it grow by half again.
+// Auto-sized lists whose rows still agree are extrapolated right away, without headroom.
+inline uint8_t * reserve_list_payload(PlyFile::PlyFileImpl::ParsingHelper & helper, const size_t bytes)
+{
+    Buffer & buffer = helper.data->buffer;
+    const size_t needed = helper.cursor->byteOffset + bytes;
+    if (needed > buffer.size_bytes())
+    {
+        size_t capacity = (std::max)({ needed, buffer.size_bytes() + buffer.size_bytes() / 2, size_t(4096) });
+        const size_t rows = helper.recorded_lists() + helper.speculative_rows + 1;
+        const bool speculating = helper.auto_list_size && helper.recorded_lists() == 0;
+        if (rows >= 1024 || speculating)
+        {
+            const double estimate = static_cast<double>(needed) / rows * helper.data->count * (speculating ? 1.0 : 1.125);
+            capacity = (std::max)(capacity, static_cast<size_t>(estimate));
+        }
+        grow_list_buffer(helper, capacity);
+    }
+    return buffer.get();
+}
+
+// Publishes the prefix sums of a variable-length list in the narrowest unsigned type that holds their total
+inline void publish_list_offsets(PlyData & data, std::vector<uint32_t> && offsets)
+{
+    const uint32_t total = offsets.back();
+    if (total > 0xffff)
+    {
+        auto storage = std::make_shared<std::vector<uint32_t>>(std::move(offsets));
+        data.list_offsets = Buffer(reinterpret_cast<const uint8_t *>(storage->data()), storage->size() * sizeof(uint32_t), storage);
+        data.list_offsets_type = Type::UINT32;
+        return;
+    }
+
+    const bool wide = total > 0xff;
+    data.list_offsets = Buffer(offsets.size() * (wide ? 2 : 1));
+    uint8_t * dst = data.list_offsets.get();
+    for (size_t i = 0; i < offsets.size(); ++i)
+    {
+        if (wide) reinterpret_cast<uint16_t *>(dst)[i] = static_cast<uint16_t>(offsets[i]);
+        else dst[i] = static_cast<uint8_t>(offsets[i]);
+    }
+    data.list_offsets_type = wide ? Type::UINT16 : Type::UINT8;
+}
+
+// Drops the growth headroom of a variable-length list buffer once it is complete. A remainder within the
+// extrapolation headroom (an eighth of the buffer) stays allocated behind an exactly-sized view of the buffer;
+// anything larger is compacted into a new allocation.
+inline void trim_list_payload(PlyFile::PlyFileImpl::ParsingHelper & helper)
+{
+    Buffer & buffer = helper.data->buffer;
+    const size_t used = helper.cursor->byteOffset;
+    if (used == buffer.size_bytes()) return;
+    if (buffer.size_bytes() - used <= buffer.size_bytes() / 8)
+    {
+        auto storage = std::make_shared<Buffer>(std::move(buffer));
+        buffer = Buffer(storage->get(), used, storage);
+    }
+    else
+    {
+        Buffer exact(used);
+        if (used) std::memcpy(exact.get(), buffer.get(), used);
+        buffer = std::move(exact);
+    }
+}
+
+namespace io
+{
+    template <bool is_binary, bool big_endian>
+    struct property_io;
+
+    // Unified binary specialization for both little and big endian
+    template <bool big_endian>
+    struct property_io<true, big_endian>
+    {
+        template <typename Source>
+        static inline size_t read(const PlyFile::PlyFileImpl::PropertyLookup & f, const PlyProperty & p, uint8_t * dest, size_t & dest_off, Source & src, uint32_t & list_size, size_t & dummy_count, size_t batch_read)
+        {
+            uint8_t * out = dest + dest_off;
+            size_t bytes = 0;
+            if (p.isList)
+            {
+                read_list_count_binary(p.listType, f.list_stride, &list_size, dummy_count, src, big_endian);
+                if (f.helper) validate_list_hint(list_size, f.helper->list_size_hint);
+                if (f.helper && (!f.helper->list_size_hint || f.helper->triangulate))
+                    out = reserve_list_payload(*f.helper, list_payload_bytes(*f.helper, list_size, f.prop_stride)) + dest_off;
+                bytes = read_property_binary(f.prop_stride * list_size, out, dest_off, src);
+            }
+            else bytes = read_property_binary(f.prop_stride * batch_read, out, dest_off, src);
+
+            // Convert the values just written while they are still in cache
+            if constexpr (big_endian) endian_swap_buffer(out, bytes, f.prop_stride);
+
+            if (p.isList && f.helper && f.helper->triangulate)
+            {
+                const size_t triangle_bytes = triangulate_list(*f.helper, out, list_size, f.prop_stride);
+                dest_off = dest_off - bytes + triangle_bytes;
+                return triangle_bytes;
+            }
+            return bytes;
+        }
+
+        template <typename Source>
+        static inline size_t skip(const PlyFile::PlyFileImpl::PropertyLookup & f, const PlyProperty & p, Source & src, uint32_t & list_size, size_t & dummy_count, size_t batch_read)
+        {
+            if (p.isList)
+            {
+                // Use safe list count reading that validates stride and handles endianness
+                read_list_count_binary(p.listType, f.list_stride, &list_size, dummy_count, src, big_endian);
+                const size_t bytes = f.prop_stride * list_size;
+                src.skip(bytes);
+                return bytes;
+            }
+            src.skip(f.prop_stride * batch_read);
+            return f.prop_stride * batch_read;
+        }
+    };
+
+    // ascii specialization
+    template <>
+    struct property_io<false, false>
+    {
+        static inline size_t read(const PlyFile::PlyFileImpl::PropertyLookup & f, const PlyProperty & p, uint8_t * dest, size_t & dest_off, ascii_source & src, uint32_t & list_size, size_t & dummy_count, size_t batch_read)
+        {
+            if (p.isList)
+            {
+                list_size = 0; // narrower count types only write the low bytes
+                read_property_ascii(p.listType, f.list_stride, &list_size, dummy_count, src);
+                if (f.helper) validate_list_hint(list_size, f.helper->list_size_hint);
+                if (f.helper && (!f.helper->list_size_hint || f.helper->triangulate))
+                    dest = reserve_list_payload(*f.helper, list_payload_bytes(*f.helper, list_size, f.prop_stride));
+                uint8_t * out = dest + dest_off;
+                for (size_t i = 0; i < list_size; ++i) read_property_ascii(p.propertyType, f.prop_stride, dest + dest_off, dest_off, src);
+                if (f.helper && f.helper->triangulate)
+                {
+                    const size_t triangle_bytes = triangulate_list(*f.helper, out, list_size, f.prop_stride);
+                    dest_off = dest_off - f.prop_stride * list_size + triangle_bytes;
+                    return triangle_bytes;
+                }
+                return f.prop_stride * list_size;
+            }
+            for (size_t i = 0; i < batch_read; ++i)
+                read_property_ascii(p.propertyType, f.prop_stride, dest + dest_off, dest_off, src);
+            return f.prop_stride * batch_read;
+        }
+
+        static inline size_t skip(const PlyFile::PlyFileImpl::PropertyLookup & f, const PlyProperty & p, ascii_source & src, uint32_t & list_size, size_t & dummy_count, size_t batch_read)
+        {
+            if (p.isList)
+            {
+                list_size = 0;
+                read_property_ascii(p.listType, f.list_stride, &list_size, dummy_count, src);
+                if (!src.skip_tokens(list_size)) throw std::runtime_error("failed to skip ascii property value");
+                return f.prop_stride * list_size;
+            }
+
+            // Skip batch_read values for batched non-list properties
+            if (!src.skip_tokens(batch_read)) throw std::runtime_error("failed to skip ascii property value");
+            return f.prop_stride * batch_read;
+
+        }
+    };
+
+} // end namespace io
+
+PlyProperty::PlyProperty(std::istream & is) : isList(false)
+{
+    std::string type;
+    is >> type;
+    if (type == "list")
+    {
+        std::string countType;
+        is >> countType >> type;
+        listType = property_type_from_string(countType);
+        isList = true;
+    }
+    propertyType = property_type_from_string(type);
+    is >> name;
+}
+
+PlyElement::PlyElement(std::istream & is)
 {
     int64_t count;
     is >> name >> count;
@@ -566,119 +1843,679 @@ std::vector<std::vector<PlyFile::PlyFileImpl::PropertyLookup>> PlyFile::PlyFileI
     return element_property_lookup;
 }
 
-size_t PlyFile::PlyFileImpl::compute_batch_size(const std::vector<PropertyLookup> & lookups, const std::vector<PlyProperty> & properties, size_t start_idx) const
+size_t PlyFile::PlyFileImpl::compute_batch_size(const std::vector<PropertyLookup> & lookups, const std::vector<PlyProperty> & properties, size_t start_idx) const
+{
+    if (start_idx >= lookups.size()) return 0;
+
+    const auto & first_lookup = lookups[start_idx];
+    const auto & first_prop = properties[start_idx];
+
+    // List properties cannot be batched - each has its own count prefix
+    if (first_prop.isList) return 1;
+
+    size_t count = 1;
+
+    if (first_lookup.skip)
+    {
+        // Count consecutive skipped non-list properties with the same stride
+        while (start_idx + count < lookups.size())
+        {
+            const auto & next_lookup = lookups[start_idx + count];
+            const auto & next_prop = properties[start_idx + count];
+            // Only batch if same stride, otherwise skip would compute wrong bytes
+            if (!next_lookup.skip || next_prop.isList || next_lookup.prop_stride != first_lookup.prop_stride) break;
+            count++;
+        }
+    }
+    else
+    {
+        // Count consecutive properties with the same helper pointer (non-list)
+        ParsingHelper * helper = first_lookup.helper;
+        while (start_idx + count < lookups.size())
+        {
+            const auto & next_lookup = lookups[start_idx + count];
+            const auto & next_prop = properties[start_idx + count];
+            if (next_lookup.skip || next_prop.isList || next_lookup.helper != helper) break;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+PlyFile::PlyFileImpl::ElementLayoutInfo PlyFile::PlyFileImpl::check_fastpath(const PlyElement & element, const std::vector<PropertyLookup> & lookups) const
+{
+    ElementLayoutInfo info;
+    info.is_fixed_layout = true;
+    info.fast_path_eligible = true;  // any fixed layout is eligible; only requested columns are gathered
+    info.row_stride = 0;
+
+    for (size_t i = 0; i < element.properties.size(); ++i)
+    {
+        const auto & prop = element.properties[i];
+        const auto & lookup = lookups[i];
+
+        info.property_offsets.push_back(info.row_stride);
+
+        // Lists are allowed if they have a known size (list_size_hint or listCount)
+        if (prop.isList)
+        {
+            uint32_t list_count = static_cast<uint32_t>(prop.listCount);
+            if (list_count == 0 && lookup.helper) list_count = lookup.helper->list_size_hint;
+
+            if (list_count == 0)
+            {
+                // Variable-length list without hint - cannot use bulk read
+                info.is_fixed_layout = false;
+                info.fast_path_eligible = false;
+                return info;
+            }
+
+            size_t bytes = lookup.list_stride + (lookup.prop_stride * list_count);
+            info.property_sizes.push_back(bytes);
+            info.row_stride += bytes;
+
+            // Triangulated lists are fanned by the scatter, but strips and lists too short to form a triangle take the row path
+            if (lookup.helper && lookup.helper->triangulate && (list_count < 3 || lookup.helper->tristrips)) info.fast_path_eligible = false;
+        }
+        else
+        {
+            info.property_sizes.push_back(lookup.prop_stride);
+            info.row_stride += lookup.prop_stride;
+        }
+    }
+
+    info.fast_path_eligible = info.fast_path_eligible && info.is_fixed_layout;
+
+    info.direct_read = info.fast_path_eligible && !lookups.empty() && std::all_of(element.properties.begin(), element.properties.end(),
+        [](const PlyProperty & p) { return !p.isList; }) && std::all_of(lookups.begin(), lookups.end(),
+        [&](const PropertyLookup & l) { return !l.skip && l.helper->data == lookups.front().helper->data; });
+
+    return info;
+}
+
+void PlyFile::PlyFileImpl::ensure_parsing_state_cached()
+{
+    if (parsing_state_cached) return;
+
+    cached_property_lut = make_property_lookup_table();
+
+    // Precompute layouts
+    cached_layouts.clear();
+    cached_layouts.reserve(elements.size());
+    for (size_t ei = 0; ei < elements.size(); ++ei)
+    {
+        cached_layouts.push_back(check_fastpath(elements[ei], cached_property_lut[ei]));
+        if (views_enabled) resolve_zero_copy_views(elements[ei], cached_property_lut[ei], cached_layouts[ei]);
+
+        const auto & lookups = cached_property_lut[ei];
+        const bool any_requested = std::any_of(lookups.begin(), lookups.end(), [](const PropertyLookup & l) { return !l.skip; });
+        const bool any_list = std::any_of(elements[ei].properties.begin(), elements[ei].properties.end(), [](const PlyProperty & p) { return p.isList; });
+        cached_layouts[ei].skip_element = !any_requested && (isBinary ? cached_layouts[ei].is_fixed_layout : !any_list);
+    }
+
+    // Precompute batches
+    cached_batches.clear();
+    cached_batches.resize(elements.size());
+    for (size_t ei = 0; ei < elements.size(); ++ei)
+    {
+        const auto & lookups = cached_property_lut[ei];
+        const auto & props = elements[ei].properties;
+        for (size_t idx = 0; idx < props.size(); )
+        {
+            size_t batch_size = compute_batch_size(lookups, props, idx);
+            cached_batches[ei].push_back({idx, batch_size});
+            idx += batch_size;
+        }
+    }
+
+    parsing_state_cached = true;
+}
+
+// A group requested with `zero_copy` can alias the source rows when its properties are adjacent, non-list
+// and the element has a fixed row stride. Its lookups become skips, so the parser steps over those bytes.
+void PlyFile::PlyFileImpl::resolve_zero_copy_views(const PlyElement & element, std::vector<PropertyLookup> & lookups, ElementLayoutInfo & layout)
+{
+    if (!layout.is_fixed_layout) return;
+
+    for (size_t pi = 0; pi < lookups.size(); )
+    {
+        ParsingHelper * helper = lookups[pi].helper;
+        if (!helper || !helper->zero_copy) { ++pi; continue; }
+
+        size_t end = pi;
+        bool has_list = false;
+        while (end < lookups.size() && lookups[end].helper && lookups[end].helper->data == helper->data)
+        {
+            has_list |= element.properties[end].isList;
+            ++end;
+        }
+
+        const size_t group_size = static_cast<size_t>(std::count_if(lookups.begin(), lookups.end(),
+            [&](const PropertyLookup & l) { return l.helper && l.helper->data == helper->data; }));
+
+        if (!has_list && group_size == end - pi)
+        {
+            helper->data->stride = layout.row_stride;
+            layout.views.push_back({ helper->data.get(), layout.property_offsets[pi], layout.property_offsets[end - 1] + layout.property_sizes[end - 1] - layout.property_offsets[pi] });
+            for (size_t i = pi; i < end; ++i)
+            {
+                lookups[i].helper = nullptr;
+                lookups[i].skip = true;
+            }
+            layout.direct_read = false;
+        }
+        pi = end;
+    }
+}
+
+// Flattens a fast-path element into per-row copies with precomputed destinations, so that any range of rows
+// can be scattered independently. Adjacent properties of the same group are merged into a single copy and
+// skipped properties produce no copy at all.
+// Each group's cursor is advanced past the `num_rows` rows it is about to receive.
+std::vector<PlyFile::PlyFileImpl::ScatterColumn> PlyFile::PlyFileImpl::plan_scatter(const PlyElement & element,
+    const std::vector<PropertyLookup> & lookups, const ElementLayoutInfo & layout, const size_t num_rows)
+{
+    std::vector<std::pair<ParsingHelper *, size_t>> groups; // {helper, bytes per row}
+    std::vector<size_t> dst_offsets(lookups.size(), 0);
+    for (size_t pi = 0; pi < lookups.size(); ++pi)
+    {
+        if (lookups[pi].skip) continue;
+        ParsingHelper * helper = lookups[pi].helper;
+        auto group = std::find_if(groups.begin(), groups.end(), [&](const std::pair<ParsingHelper *, size_t> & g) { return g.first->data == helper->data; });
+        if (group == groups.end()) group = groups.insert(groups.end(), { helper, 0 });
+
+        const auto & prop = element.properties[pi];
+        dst_offsets[pi] = group->second;
+        const size_t payload = prop.isList ? layout.property_sizes[pi] - lookups[pi].list_stride : layout.property_sizes[pi];
+        group->second += prop.isList ? list_payload_bytes(*helper, payload / lookups[pi].prop_stride, lookups[pi].prop_stride) : payload;
+    }
+
+    std::vector<ScatterColumn> columns;
+    for (size_t pi = 0; pi < lookups.size(); ++pi)
+    {
+        const auto & lookup = lookups[pi];
+        if (lookup.skip) continue;
+        const auto & prop = element.properties[pi];
+        const auto group = std::find_if(groups.begin(), groups.end(), [&](const std::pair<ParsingHelper *, size_t> & g) { return g.first->data == lookup.helper->data; });
+
+        ScatterColumn c;
+        c.src_offset = layout.property_offsets[pi];
+        c.size = layout.property_sizes[pi];
+        c.dst = lookup.helper->data->buffer.get() + lookup.helper->cursor->byteOffset + dst_offsets[pi];
+        c.dst_stride = group->second;
+        c.swap_width = isBigEndian && lookup.prop_stride > 1 ? lookup.prop_stride : 0;
+        if (prop.isList)
+        {
+            c.count_offset = c.src_offset;
+            c.count_stride = lookup.list_stride;
+            c.count_type = prop.listType;
+            c.count_big_endian = isBigEndian;
+            c.expected_count = prop.listCount ? static_cast<uint32_t>(prop.listCount) : lookup.helper->list_size_hint;
+
+            // Encode the expected count in the file's byte order once, so rows are checked with a plain compare
+            // instead of decoding every count. Counts the prefix type cannot hold are decoded (and rejected).
+            uint8_t raw[4] = { 0, 0, 0, 0 };
+            if (c.count_stride > sizeof(raw)) throw std::runtime_error("invalid list count type: stride exceeds 4 bytes (list counts must be integer types");
+            for (size_t k = 0; k < c.count_stride; ++k) raw[isBigEndian ? c.count_stride - 1 - k : k] = static_cast<uint8_t>(c.expected_count >> (8 * k));
+            std::memcpy(&c.expected_raw, raw, sizeof(raw));
+            if (decode_list_count(c.count_type, raw, c.count_stride, isBigEndian) == c.expected_count) c.raw_count_stride = c.count_stride;
+            c.src_offset += lookup.list_stride;
+            c.size -= lookup.list_stride;
+            if (lookup.helper->triangulate) c.fan_items = c.size / lookup.prop_stride;
+        }
+
+        ScatterColumn * prev = columns.empty() ? nullptr : &columns.back();
+        if (prev && !prev->count_stride && !c.count_stride && prev->dst_stride == c.dst_stride &&
+            prev->src_offset + prev->size == c.src_offset && prev->dst + prev->size == c.dst)
+        {
+            prev->size += c.size;
+        }
+        else columns.push_back(c);
+    }
+
+    size_t dst_bytes = 0;
+    for (auto & group : groups) dst_bytes += num_rows * group.second;
+    for (auto & group : groups) group.first->cursor->byteOffset += num_rows * group.second;
+
+    for (auto & c : columns) c.kernel = c.fan_items ? select_fan_kernel(c.size / c.fan_items, c.swap_width) : select_scatter_kernel(c.size, c.swap_width);
+    select_transpose_kernels(columns, read_options.non_temporal_bytes && dst_bytes >= read_options.non_temporal_bytes);
+
+    return columns;
+}
+
+// Copies one column of `num_rows` rows starting at element row `row`. With a non-zero `Size` the copy
+// compiles to fixed-size loads and stores; `Size == 0` handles any other width. A non-zero `Swap` converts
+// big-endian items of that width right after they are copied, while the destination is still in cache.
+template <size_t Size, size_t Swap>
+void PlyFile::PlyFileImpl::scatter_column(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows)
+{
+    validate_column(c, rows, row_stride, num_rows);
+
+    const size_t size = Size ? Size : c.size;
+    const uint8_t * src = rows + c.src_offset;
+    uint8_t * dst = c.dst + row * c.dst_stride;
+    for (size_t i = 0; i < num_rows; ++i, src += row_stride, dst += c.dst_stride)
+    {
+        std::memcpy(dst, src, size);
+        if constexpr (Swap != 0) byte_swap_items<Swap>(dst, size / Swap);
+    }
+}
+
+// Writes each row's polygon of a triangulated list column as its fan of triangles (v0, vi, vi+1), so that
+// triangulated faces keep the bulk path. Items are swapped after the triangles are assembled.
+template <size_t Stride, bool Swap>
+void PlyFile::PlyFileImpl::scatter_fan(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows)
+{
+    validate_column(c, rows, row_stride, num_rows);
+
+    const size_t triangles = c.fan_items - 2;
+    const uint8_t * src = rows + c.src_offset;
+    uint8_t * dst = c.dst + row * c.dst_stride;
+    for (size_t i = 0; i < num_rows; ++i, src += row_stride, dst += c.dst_stride)
+    {
+        uint8_t * triangle = dst;
+        for (size_t t = 1; t <= triangles; ++t, triangle += 3 * Stride)
+        {
+            std::memcpy(triangle, src, Stride);
+            std::memcpy(triangle + Stride, src + t * Stride, 2 * Stride);
+        }
+        if constexpr (Swap) byte_swap_items<Stride>(dst, 3 * triangles);
+    }
+}
+
+PlyFile::PlyFileImpl::ScatterKernel PlyFile::PlyFileImpl::select_fan_kernel(const size_t stride, const size_t swap)
+{
+    switch (stride)
+    {
+    case 1: return &scatter_fan<1, false>;
+    case 2: return swap ? &scatter_fan<2, true> : &scatter_fan<2, false>;
+    case 4: return swap ? &scatter_fan<4, true> : &scatter_fan<4, false>;
+    case 8: return swap ? &scatter_fan<8, true> : &scatter_fan<8, false>;
+    default: throw std::invalid_argument("invalid ply property");
+    }
+}
+
+// Widths of common columns: scalars, xyz/rgb(a) groups, and the payloads of fixed-size triangle/quad lists
+PlyFile::PlyFileImpl::ScatterKernel PlyFile::PlyFileImpl::select_scatter_kernel(const size_t size, const size_t swap)
+{
+    switch (swap)
+    {
+    case 2: return select_swap_kernel<2>(size);
+    case 4: return select_swap_kernel<4>(size);
+    case 8: return select_swap_kernel<8>(size);
+    default: break;
+    }
+
+    switch (size)
+    {
+    case 1:  return &scatter_column<1, 0>;
+    case 2:  return &scatter_column<2, 0>;
+    case 3:  return &scatter_column<3, 0>;
+    case 4:  return &scatter_column<4, 0>;
+    case 6:  return &scatter_column<6, 0>;
+    case 8:  return &scatter_column<8, 0>;
+    case 12: return &scatter_column<12, 0>;
+    case 16: return &scatter_column<16, 0>;
+    case 24: return &scatter_column<24, 0>;
+    case 32: return &scatter_column<32, 0>;
+    default: return &scatter_column<0, 0>;
+    }
+}
+
+// Big-endian columns of one to four items (scalars, pairs, xyz, rgba and triangle/quad lists)
+template <size_t Swap>
+PlyFile::PlyFileImpl::ScatterKernel PlyFile::PlyFileImpl::select_swap_kernel(const size_t size)
+{
+    switch (size / Swap)
+    {
+    case 1:  return &scatter_column<Swap, Swap>;
+    case 2:  return &scatter_column<2 * Swap, Swap>;
+    case 3:  return &scatter_column<3 * Swap, Swap>;
+    case 4:  return &scatter_column<4 * Swap, Swap>;
+    default: return &scatter_column<0, Swap>;
+    }
+}
+
+// Properties requested one per group (e.g. every splat attribute separately) become adjacent 4 or 8 byte
+// columns that each own a contiguous destination. Runs of them are de-interleaved together by transposing
+// blocks of rows in SIMD registers; whatever does not fill a transpose keeps its scalar kernel.
+// With `stream`, transposes whose destinations share an alignment write them with non-temporal stores.
+void PlyFile::PlyFileImpl::select_transpose_kernels(std::vector<ScatterColumn> & columns, const bool stream)
+{
+    // Big-endian columns are only transposed when they hold a single item, so one swap width covers all lanes
+    auto transposable = [](const ScatterColumn & c, const size_t width)
+    {
+        return c.size == width && c.dst_stride == width && !c.count_stride && (!c.swap_width || c.swap_width == width);
+    };
+
+    auto co_aligned = [&](const size_t first, const size_t lanes, const size_t vector_bytes)
+    {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(columns[first].dst);
+        if (base % columns[first].size) return false;
+        for (size_t k = 1; k < lanes; ++k) if ((reinterpret_cast<uintptr_t>(columns[first + k].dst) - base) % vector_bytes) return false;
+        return true;
+    };
+
+    for (size_t i = 0; i < columns.size(); )
+    {
+        const size_t width = columns[i].size;
+        if ((width != 4 && width != 8) || !transposable(columns[i], width)) { ++i; continue; }
+
+        size_t run = 1;
+        while (i + run < columns.size() && transposable(columns[i + run], width) &&
+            columns[i + run].swap_width == columns[i].swap_width &&
+            columns[i + run].src_offset == columns[i + run - 1].src_offset + width) ++run;
+
+        for (size_t end = i + run; i < end; )
+        {
+            size_t lanes = 0;
+#if defined(TINYPLY_AVX2)
+            if (width == 4 && end - i >= 8) lanes = 8;
+            else if (width == 8 && end - i >= 4) lanes = 4;
+#endif
+#if defined(TINYPLY_SSE2)
+            if (!lanes && width == 4 && end - i >= 4) lanes = 4;
+            else if (!lanes && width == 8 && end - i >= 2) lanes = 2;
+#endif
+            if (!lanes) { ++i; continue; }
+
+            const bool co_aligned_stream = stream && co_aligned(i, lanes, lanes * width);
+            columns[i].kernel = select_transpose_kernel(lanes, width, co_aligned_stream, columns[i].swap_width != 0);
+            columns[i].lanes = lanes;
+            i += lanes;
+        }
+    }
+}
+
+PlyFile::PlyFileImpl::ScatterKernel PlyFile::PlyFileImpl::select_transpose_kernel(const size_t lanes, const size_t width, const bool stream, const bool swap)
+{
+    if (stream) return swap ? select_transpose_kernel<true, true>(lanes, width) : select_transpose_kernel<true, false>(lanes, width);
+    return swap ? select_transpose_kernel<false, true>(lanes, width) : select_transpose_kernel<false, false>(lanes, width);
+}
+
+template <bool Stream, bool Swap>
+PlyFile::PlyFileImpl::ScatterKernel PlyFile::PlyFileImpl::select_transpose_kernel(const size_t lanes, const size_t width)
+{
+#if defined(TINYPLY_AVX2)
+    if (lanes == 8 && width == 4) return &transpose_8x32<Stream, Swap>;
+    if (lanes == 4 && width == 8) return &transpose_4x64<Stream, Swap>;
+#endif
+#if defined(TINYPLY_SSE2)
+    if (lanes == 4 && width == 4) return &transpose_4x32<Stream, Swap>;
+    if (lanes == 2 && width == 8) return &transpose_2x64<Stream, Swap>;
+#else
+    (void)lanes; (void)width;
+#endif
+    return nullptr;
+}
+
+#if defined(TINYPLY_SSE2)
+// Streaming kernels first copy the rows that precede the next `vector_bytes` boundary of the (co-aligned) destinations
+inline size_t stream_peel_rows(const uint8_t * dst, const size_t width, const size_t vector_bytes, const size_t num_rows)
+{
+    const size_t misalignment = reinterpret_cast<uintptr_t>(dst) % vector_bytes;
+    return (std::min)(num_rows, misalignment ? (vector_bytes - misalignment) / width : 0);
+}
+
+// Big-endian sources are converted as they are loaded, so each value is swapped once while in a register
+template <bool Swap, size_t Width>
+inline __m128i load_128(const uint8_t * src)
+{
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    if constexpr (Swap) return byte_swap_128<Width>(v);
+    else return v;
+}
+
+template <bool Stream>
+inline void store_128(uint8_t * dst, const __m128i v)
+{
+    if constexpr (Stream) _mm_stream_si128(reinterpret_cast<__m128i *>(dst), v);
+    else _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), v);
+}
+
+template <bool Stream, bool Swap>
+void PlyFile::PlyFileImpl::transpose_4x32(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows)
 {
-    if (start_idx >= lookups.size()) return 0;
-
-    const auto & first_lookup = lookups[start_idx];
-    const auto & first_prop = properties[start_idx];
-
-    // List properties cannot be batched - each has its own count prefix
-    if (first_prop.isList) return 1;
+    const ScatterColumn * lane = &c;
+    uint8_t * d0 = lane[0].dst + row * 4;
+    uint8_t * d1 = lane[1].dst + row * 4;
+    uint8_t * d2 = lane[2].dst + row * 4;
+    uint8_t * d3 = lane[3].dst + row * 4;
 
-    size_t count = 1;
+    size_t i = Stream ? stream_peel_rows(d0, 4, 16, num_rows) : 0;
+    for (size_t k = 0; k < 4 && i; ++k) scatter_column<4, Swap ? 4 : 0>(lane[k], rows, row_stride, row, i);
 
-    if (first_lookup.skip)
+    for (const uint8_t * src = rows + c.src_offset + i * row_stride; i + 4 <= num_rows; i += 4, src += 4 * row_stride)
     {
-        // Count consecutive skipped non-list properties with the same stride
-        while (start_idx + count < lookups.size())
-        {
-            const auto & next_lookup = lookups[start_idx + count];
-            const auto & next_prop = properties[start_idx + count];
-            // Only batch if same stride, otherwise skip would compute wrong bytes
-            if (!next_lookup.skip || next_prop.isList || next_lookup.prop_stride != first_lookup.prop_stride) break;
-            count++;
-        }
+        const __m128i r0 = load_128<Swap, 4>(src);
+        const __m128i r1 = load_128<Swap, 4>(src + row_stride);
+        const __m128i r2 = load_128<Swap, 4>(src + 2 * row_stride);
+        const __m128i r3 = load_128<Swap, 4>(src + 3 * row_stride);
+        const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+        const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+        const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+        const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+        store_128<Stream>(d0 + i * 4, _mm_unpacklo_epi64(t0, t1));
+        store_128<Stream>(d1 + i * 4, _mm_unpackhi_epi64(t0, t1));
+        store_128<Stream>(d2 + i * 4, _mm_unpacklo_epi64(t2, t3));
+        store_128<Stream>(d3 + i * 4, _mm_unpackhi_epi64(t2, t3));
     }
-    else
+    for (size_t k = 0; k < 4 && i < num_rows; ++k) scatter_column<4, Swap ? 4 : 0>(lane[k], rows + i * row_stride, row_stride, row + i, num_rows - i);
+}
+
+template <bool Stream, bool Swap>
+void PlyFile::PlyFileImpl::transpose_2x64(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows)
+{
+    const ScatterColumn * lane = &c;
+    uint8_t * d0 = lane[0].dst + row * 8;
+    uint8_t * d1 = lane[1].dst + row * 8;
+
+    size_t i = Stream ? stream_peel_rows(d0, 8, 16, num_rows) : 0;
+    for (size_t k = 0; k < 2 && i; ++k) scatter_column<8, Swap ? 8 : 0>(lane[k], rows, row_stride, row, i);
+
+    for (const uint8_t * src = rows + c.src_offset + i * row_stride; i + 2 <= num_rows; i += 2, src += 2 * row_stride)
     {
-        // Count consecutive properties with the same helper pointer (non-list)
-        ParsingHelper * helper = first_lookup.helper;
-        while (start_idx + count < lookups.size())
-        {
-            const auto & next_lookup = lookups[start_idx + count];
-            const auto & next_prop = properties[start_idx + count];
-            if (next_lookup.skip || next_prop.isList || next_lookup.helper != helper) break;
-            count++;
-        }
+        const __m128i r0 = load_128<Swap, 8>(src);
+        const __m128i r1 = load_128<Swap, 8>(src + row_stride);
+        store_128<Stream>(d0 + i * 8, _mm_unpacklo_epi64(r0, r1));
+        store_128<Stream>(d1 + i * 8, _mm_unpackhi_epi64(r0, r1));
     }
+    for (size_t k = 0; k < 2 && i < num_rows; ++k) scatter_column<8, Swap ? 8 : 0>(lane[k], rows + i * row_stride, row_stride, row + i, num_rows - i);
+}
+#endif
 
-    return count;
+#if defined(TINYPLY_AVX2)
+template <bool Swap, size_t Width>
+inline __m256i load_256(const uint8_t * src)
+{
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+    if constexpr (Swap) return byte_swap_256<Width>(v);
+    else return v;
 }
 
-PlyFile::PlyFileImpl::ElementLayoutInfo PlyFile::PlyFileImpl::check_fastpath(const PlyElement & element, const std::vector<PropertyLookup> & lookups) const
+template <bool Stream>
+inline void store_256(uint8_t * dst, const __m256i v)
 {
-    ElementLayoutInfo info;
-    info.is_fixed_layout = true;
-    info.fast_path_eligible = true;  // assume eligible until proven otherwise
-    info.row_stride = 0;
+    if constexpr (Stream) _mm256_stream_si256(reinterpret_cast<__m256i *>(dst), v);
+    else _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), v);
+}
 
-    for (size_t i = 0; i < element.properties.size(); ++i)
+template <bool Stream, bool Swap>
+void PlyFile::PlyFileImpl::transpose_8x32(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows)
+{
+    const ScatterColumn * lane = &c;
+    uint8_t * d[8];
+    for (size_t k = 0; k < 8; ++k) d[k] = lane[k].dst + row * 4;
+
+    size_t i = Stream ? stream_peel_rows(d[0], 4, 32, num_rows) : 0;
+    for (size_t k = 0; k < 8 && i; ++k) scatter_column<4, Swap ? 4 : 0>(lane[k], rows, row_stride, row, i);
+
+    for (const uint8_t * src = rows + c.src_offset + i * row_stride; i + 8 <= num_rows; i += 8, src += 8 * row_stride)
     {
-        const auto & prop = element.properties[i];
-        const auto & lookup = lookups[i];
+        __m256i r[8];
+        for (size_t k = 0; k < 8; ++k) r[k] = load_256<Swap, 4>(src + k * row_stride);
+
+        // 4x4 transposes within each 128-bit half, then the halves are exchanged between registers
+        const __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]), t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+        const __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]), t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+        const __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]), t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+        const __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]), t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+        const __m256i u0 = _mm256_unpacklo_epi64(t0, t2), u1 = _mm256_unpackhi_epi64(t0, t2);
+        const __m256i u2 = _mm256_unpacklo_epi64(t1, t3), u3 = _mm256_unpackhi_epi64(t1, t3);
+        const __m256i u4 = _mm256_unpacklo_epi64(t4, t6), u5 = _mm256_unpackhi_epi64(t4, t6);
+        const __m256i u6 = _mm256_unpacklo_epi64(t5, t7), u7 = _mm256_unpackhi_epi64(t5, t7);
+        store_256<Stream>(d[0] + i * 4, _mm256_permute2x128_si256(u0, u4, 0x20));
+        store_256<Stream>(d[1] + i * 4, _mm256_permute2x128_si256(u1, u5, 0x20));
+        store_256<Stream>(d[2] + i * 4, _mm256_permute2x128_si256(u2, u6, 0x20));
+        store_256<Stream>(d[3] + i * 4, _mm256_permute2x128_si256(u3, u7, 0x20));
+        store_256<Stream>(d[4] + i * 4, _mm256_permute2x128_si256(u0, u4, 0x31));
+        store_256<Stream>(d[5] + i * 4, _mm256_permute2x128_si256(u1, u5, 0x31));
+        store_256<Stream>(d[6] + i * 4, _mm256_permute2x128_si256(u2, u6, 0x31));
+        store_256<Stream>(d[7] + i * 4, _mm256_permute2x128_si256(u3, u7, 0x31));
+    }
+    for (size_t k = 0; k < 8 && i < num_rows; ++k) scatter_column<4, Swap ? 4 : 0>(lane[k], rows + i * row_stride, row_stride, row + i, num_rows - i);
+}
 
-        info.property_offsets.push_back(info.row_stride);
+template <bool Stream, bool Swap>
+void PlyFile::PlyFileImpl::transpose_4x64(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t row, const size_t num_rows)
+{
+    const ScatterColumn * lane = &c;
+    uint8_t * d0 = lane[0].dst + row * 8;
+    uint8_t * d1 = lane[1].dst + row * 8;
+    uint8_t * d2 = lane[2].dst + row * 8;
+    uint8_t * d3 = lane[3].dst + row * 8;
 
-        // Fast path eligibility: all properties must be requested (no skips)
-        // Lists are allowed if they have a known size (list_size_hint or listCount)
-        if (lookup.skip) info.fast_path_eligible = false;
+    size_t i = Stream ? stream_peel_rows(d0, 8, 32, num_rows) : 0;
+    for (size_t k = 0; k < 4 && i; ++k) scatter_column<8, Swap ? 8 : 0>(lane[k], rows, row_stride, row, i);
 
-        if (prop.isList)
-        {
-            uint32_t list_count = static_cast<uint32_t>(prop.listCount);
-            if (list_count == 0 && lookup.helper) list_count = lookup.helper->list_size_hint;
+    for (const uint8_t * src = rows + c.src_offset + i * row_stride; i + 4 <= num_rows; i += 4, src += 4 * row_stride)
+    {
+        const __m256i r0 = load_256<Swap, 8>(src);
+        const __m256i r1 = load_256<Swap, 8>(src + row_stride);
+        const __m256i r2 = load_256<Swap, 8>(src + 2 * row_stride);
+        const __m256i r3 = load_256<Swap, 8>(src + 3 * row_stride);
+        const __m256i t0 = _mm256_unpacklo_epi64(r0, r1), t1 = _mm256_unpackhi_epi64(r0, r1);
+        const __m256i t2 = _mm256_unpacklo_epi64(r2, r3), t3 = _mm256_unpackhi_epi64(r2, r3);
+        store_256<Stream>(d0 + i * 8, _mm256_permute2x128_si256(t0, t2, 0x20));
+        store_256<Stream>(d1 + i * 8, _mm256_permute2x128_si256(t1, t3, 0x20));
+        store_256<Stream>(d2 + i * 8, _mm256_permute2x128_si256(t0, t2, 0x31));
+        store_256<Stream>(d3 + i * 8, _mm256_permute2x128_si256(t1, t3, 0x31));
+    }
+    for (size_t k = 0; k < 4 && i < num_rows; ++k) scatter_column<8, Swap ? 8 : 0>(lane[k], rows + i * row_stride, row_stride, row + i, num_rows - i);
+}
+#endif
 
-            if (list_count == 0)
-            {
-                // Variable-length list without hint - cannot use bulk read
-                info.is_fixed_layout = false;
-                info.fast_path_eligible = false;
-                return info;
-            }
+// Validates the count prefixes of a fixed-size list column; other columns have nothing to check
+void PlyFile::PlyFileImpl::validate_column(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t num_rows)
+{
+    switch (c.count_stride ? c.raw_count_stride : size_t(-1))
+    {
+    case size_t(-1): break;
+    case 1:  validate_list_counts<1>(c, rows, row_stride, num_rows); break;
+    case 2:  validate_list_counts<2>(c, rows, row_stride, num_rows); break;
+    case 4:  validate_list_counts<4>(c, rows, row_stride, num_rows); break;
+    default: validate_list_counts<0>(c, rows, row_stride, num_rows); break;
+    }
+}
 
-            size_t bytes = lookup.list_stride + (lookup.prop_stride * list_count);
-            info.property_sizes.push_back(bytes);
-            info.row_stride += bytes;
-        }
-        else
+// Compares each row's count prefix, as stored, against the encoded expected count. Only a mismatch (or
+// `RawStride == 0`) decodes the count, which reports it the same way as the row-by-row reader.
+template <size_t RawStride>
+void PlyFile::PlyFileImpl::validate_list_counts(const ScatterColumn & c, const uint8_t * rows, const size_t row_stride, const size_t num_rows)
+{
+    typedef typename std::conditional<RawStride == 1, uint8_t, typename std::conditional<RawStride == 2, uint16_t, uint32_t>::type>::type word_t;
+
+    const uint8_t * count_ptr = rows + c.count_offset;
+    for (size_t i = 0; i < num_rows; ++i, count_ptr += row_stride)
+    {
+        if constexpr (RawStride != 0)
         {
-            info.property_sizes.push_back(lookup.prop_stride);
-            info.row_stride += lookup.prop_stride;
+            word_t raw;
+            std::memcpy(&raw, count_ptr, RawStride);
+            if (raw == static_cast<word_t>(c.expected_raw)) continue;
         }
+        validate_list_hint(decode_list_count(c.count_type, count_ptr, c.count_stride, c.count_big_endian), c.expected_count);
     }
+}
 
-    info.fast_path_eligible = info.fast_path_eligible && info.is_fixed_layout;
+// `rows` holds the source rows starting at element row `first_row`. Rows are processed in L2-sized tiles:
+// each column's kernel runs over a tile while it is cached, so wide elements write runs of a few KB to each
+// destination instead of a few bytes at a time. The next tile is prefetched meanwhile.
+void PlyFile::PlyFileImpl::scatter_rows(const uint8_t * rows, const size_t row_stride, const size_t first_row, const size_t row_begin, const size_t row_end,
+    const std::vector<ScatterColumn> & columns)
+{
+    static const size_t tile_bytes = size_t(256) << 10;
+    const size_t tile_rows = (std::max)(size_t(1), tile_bytes / row_stride);
+    for (size_t tile = row_begin; tile < row_end; tile += tile_rows)
+    {
+        const size_t num_rows = (std::min)(tile_rows, row_end - tile);
+        const uint8_t * tile_ptr = rows + ((tile - first_row) * row_stride);
 
-    return info;
+        const uint8_t * next = tile_ptr + num_rows * row_stride;
+        const uint8_t * next_end = next + (std::min)(tile_rows, row_end - tile - num_rows) * row_stride;
+        for (; next < next_end; next += 64) TINYPLY_PREFETCH(next);
+
+        for (size_t i = 0; i < columns.size(); i += columns[i].lanes) columns[i].kernel(columns[i], tile_ptr, row_stride, tile, num_rows);
+    }
+
+#if defined(TINYPLY_SSE2)
+    _mm_sfence(); // order any non-temporal stores before the rows are handed back
+#endif
 }
 
-void PlyFile::PlyFileImpl::ensure_parsing_state_cached()
+// Number of tasks worth splitting `total_bytes` of work into: one per thread, but no task smaller than a few MB
+size_t PlyFile::PlyFileImpl::parallel_task_count(const size_t total_bytes) const
 {
-    if (parsing_state_cached) return;
+    static const size_t min_task_bytes = size_t(4) << 20;
+    size_t threads = read_options.num_threads ? read_options.num_threads : std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    return (std::max)(size_t(1), (std::min)(threads, total_bytes / min_task_bytes));
+}
 
-    cached_property_lut = make_property_lookup_table();
+void PlyFile::PlyFileImpl::parallel_for(const size_t count, const std::function<void(size_t)> & job)
+{
+    if (count == 1)
+    {
+        job(0);
+        return;
+    }
 
-    // Precompute batches
-    cached_batches.resize(elements.size());
-    for (size_t ei = 0; ei < elements.size(); ++ei)
+    // Exceptions (e.g. a list_size_hint mismatch) are captured and the first one is rethrown on this thread
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto guarded_job = [&](size_t i)
     {
-        const auto & lookups = cached_property_lut[ei];
-        const auto & props = elements[ei].properties;
-        for (size_t idx = 0; idx < props.size(); )
+        try { job(i); }
+        catch (...)
         {
-            size_t batch_size = compute_batch_size(lookups, props, idx);
-            cached_batches[ei].push_back({idx, batch_size});
-            idx += batch_size;
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) error = std::current_exception();
         }
+    };
+
+    if (read_options.executor)
+    {
+        read_options.executor(count, guarded_job);
+    }
+    else
+    {
+        std::atomic<size_t> next{ 0 };
+        auto worker = [&]() { for (size_t i = next++; i < count; i = next++) guarded_job(i); };
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < count; ++t) threads.emplace_back(worker);
+        worker();
+        for (auto & t : threads) t.join();
     }
 
-    // Precompute layouts
-    cached_layouts.reserve(elements.size());
-    for (size_t ei = 0; ei < elements.size(); ++ei)
-        cached_layouts.push_back(check_fastpath(elements[ei], cached_property_lut[ei]));
+    if (error) std::rethrow_exception(error);
+}
 
-    parsing_state_cached = true;
+bool PlyFile::PlyFileImpl::parse_header(const uint8_t * data, const size_t size)
+{
+    io::span_streambuf buf(data, size);
+    std::istream is(&buf);
+    return parse_header(is);
 }
 
 bool PlyFile::PlyFileImpl::parse_header(std::istream & is)
@@ -772,124 +2609,412 @@ void PlyFile::PlyFileImpl::write_property_binary(std::ostream & os, const uint8_
 }
 
 void PlyFile::PlyFileImpl::read(std::istream & is)
+{
+    if (isBinary)
+    {
+        io::stream_source src(is);
+        read_impl(src);
+    }
+    else
+    {
+        io::ascii_source src(is);
+        read_impl(src);
+    }
+}
+
+void PlyFile::PlyFileImpl::read(const uint8_t * data, const size_t size, std::shared_ptr<const void> owner)
+{
+    const size_t payload_offset = io::find_payload_offset(data, size);
+    if (isBinary)
+    {
+        io::span_source src(data + payload_offset, size - payload_offset);
+        source_owner = owner;
+        read_impl(src);
+        source_owner.reset();
+    }
+    else
+    {
+        io::ascii_source src(data + payload_offset, size - payload_offset);
+        read_impl(src);
+    }
+}
+
+const io::mapped_file & PlyFile::PlyFileImpl::map_file(const std::string & filepath)
+{
+    if (!mapped || mapped->path != filepath) mapped = std::make_shared<io::mapped_file>(filepath);
+    return *mapped;
+}
+
+template <typename Source>
+void PlyFile::PlyFileImpl::read_impl(Source & src)
 {
     for (auto & entry : userData)
     {
         entry.second.cursor->byteOffset = 0;
         entry.second.cursor->totalSizeBytes = 0;
+        entry.second.temp_list_sizes.clear();
+        entry.second.temp_list_offsets.clear();
+        entry.second.speculative_list_size = 0;
+        entry.second.speculative_rows = 0;
+        if (entry.second.data->isList && !entry.second.list_size_hint)
+        {
+            entry.second.data->list_sizes.clear();
+            entry.second.data->list_offsets = Buffer();
+            entry.second.data->list_offsets_type = Type::INVALID;
+        }
+        entry.second.data->list_size_histogram.clear();
+        entry.second.data->count = entry.second.num_rows;
+        if (entry.second.triangulate) entry.second.data->triangle_faces.clear();
+
+        // A buffer filled with a different number of rows (e.g. a row range) does not fit this read
+        if (entry.second.rows_read != entry.second.num_rows) entry.second.data->buffer = Buffer();
+
+        // Drop views from a previous read; they are re-established below if still possible
+        if (entry.second.data->stride)
+        {
+            entry.second.data->stride = 0;
+            entry.second.data->buffer = Buffer();
+        }
     }
 
+    // Zero-copy views need the whole little-endian payload to be addressable in memory
+    views_enabled = std::is_same<Source, io::span_source>::value && isBinary && !isBigEndian;
     parsing_state_cached = false;
+    ensure_parsing_state_cached();
 
     std::vector<std::shared_ptr<PlyData>> buffers;
     for (auto & entry : userData) buffers.push_back(entry.second.data);
 
-    // Determine if first pass is needed: only required if we have list properties without hints.
-    // Non-list properties always have deterministic sizes, so they never require a first pass.
+    // Process collected list sizes: detect fixed vs variable-length
+    auto adopt_list_sizes = [&]()
+    {
+        for (auto & entry : userData)
+        {
+            auto & helper = entry.second;
+            if (helper.auto_list_size && helper.data->isList)
+            {
+                auto & histogram = helper.data->list_size_histogram;
+                histogram.clear();
+                if (helper.speculative_rows) histogram[helper.speculative_list_size] = helper.speculative_rows;
+                for (const size_t size : helper.temp_list_sizes) ++histogram[size];
+                for (size_t i = 1; i < helper.temp_list_offsets.size(); ++i) ++histogram[helper.temp_list_offsets[i] - helper.temp_list_offsets[i - 1]];
+            }
+            if (helper.data->isList && !helper.temp_list_sizes.empty())
+            {
+                bool all_same = std::adjacent_find( helper.temp_list_sizes.begin(), helper.temp_list_sizes.end(), std::not_equal_to<size_t>()) == helper.temp_list_sizes.end();
+                if (!all_same) helper.data->list_sizes = std::move(helper.temp_list_sizes);
+                helper.temp_list_sizes.clear();
+                helper.temp_list_sizes.shrink_to_fit();
+            }
+            if (helper.data->isList && helper.temp_list_offsets.size() > 1)
+            {
+                const auto & offsets = helper.temp_list_offsets;
+                const uint32_t first = offsets[1] - offsets[0];
+                bool all_same = true;
+                for (size_t i = 2; i < offsets.size() && all_same; ++i) all_same = offsets[i] - offsets[i - 1] == first;
+                if (!all_same) publish_list_offsets(*helper.data, std::move(helper.temp_list_offsets));
+            }
+            helper.temp_list_offsets.clear();
+            helper.temp_list_offsets.shrink_to_fit();
+        }
+    };
+
+    // A first pass is only needed to presize list properties without hints; otherwise their buffers grow
+    // during the single pass. Non-list properties always have deterministic sizes.
+    bool all_sized = false;
+    size_lists_from_index(all_sized);
     bool need_first_pass = false;
     for (const auto & entry : userData)
     {
-        if (entry.second.data->isList && entry.second.list_size_hint == 0)
+        if (read_options.presize_lists && !all_sized && entry.second.data->isList && entry.second.list_size_hint == 0)
         {
             need_first_pass = true;
             break;
         }
     }
+    lists_counted = need_first_pass;
 
     if (need_first_pass)
     {
-        parse_data(is, true);
+        parse_data(src, true);
+        adopt_list_sizes();
+    }
+
+    // Count the number of properties (required for allocation)
+    // e.g. if we have properties x y and z requested, we ensure
+    // that their buffer points to the same PlyData
+    std::unordered_map<PlyData*, int32_t> unique_data_count;
+    for (auto & ptr : buffers) unique_data_count[ptr.get()] += 1;
+
+    // Since group-requested properties share the same cursor,
+    // we need to find unique cursors so we only allocate once
+    std::sort(buffers.begin(), buffers.end());
+    buffers.erase(std::unique(buffers.begin(), buffers.end()), buffers.end());
 
-        // Process collected list sizes: detect fixed vs variable-length
+    // Allocate buffers based on property type:
+    // - Non-list properties: deterministic size (count * stride * num_properties)
+    // - List properties with hint: computed from hint
+    // - List properties without hint: computed from first pass
+    for (auto & b : buffers)
+    {
         for (auto & entry : userData)
         {
-            auto & helper = entry.second;
-            if (helper.data->isList && !helper.temp_list_sizes.empty())
+            if (entry.second.data == b && b->buffer.get() == nullptr && b->stride == 0)
             {
-                bool all_same = std::adjacent_find( helper.temp_list_sizes.begin(), helper.temp_list_sizes.end(), std::not_equal_to<size_t>()) == helper.temp_list_sizes.end();
-                if (!all_same) helper.data->list_sizes = std::move(helper.temp_list_sizes);
-                helper.temp_list_sizes.clear();
-                helper.temp_list_sizes.shrink_to_fit();
+                if (entry.second.data->isList)
+                {
+                    if (entry.second.list_size_hint > 0)
+                    {
+                        // List with hint: compute size from hint
+                        const size_t hint = entry.second.list_size_hint;
+                        const size_t items = entry.second.triangulate ? (hint >= 3 ? 3 * (hint - 2) : 0) : hint;
+                        auto bytes_per_property = entry.second.data->count * PropertyTable[entry.second.data->t].stride * items;
+                        bytes_per_property *= unique_data_count[b.get()];
+                        b->buffer = Buffer(bytes_per_property);
+                    }
+                    else
+                    {
+                        // List without hint: use the first pass result, or start empty and grow while parsing
+                        b->buffer = Buffer(entry.second.cursor->totalSizeBytes);
+                    }
+                }
+                else
+                {
+                    // Non-list: deterministic size, no hint or first pass needed
+                    auto bytes_per_property = entry.second.data->count * PropertyTable[entry.second.data->t].stride;
+                    bytes_per_property *= unique_data_count[b.get()];
+                    b->buffer = Buffer(bytes_per_property);
+                }
+            }
+        }
+    }
+
+    // Populate the data (big-endian values are converted as they are copied)
+    parse_data(src, false);
+
+    if (!need_first_pass)
+    {
+        for (auto & entry : userData)
+        {
+            if (entry.second.data->isList && entry.second.list_size_hint == 0) trim_list_payload(entry.second);
+        }
+        adopt_list_sizes();
+    }
+
+    // Triangulated lists are fixed-size lists of triangles
+    for (auto & entry : userData)
+    {
+        auto & helper = entry.second;
+        if (!helper.triangulate || !helper.data->isList) continue;
+        trim_list_payload(helper);
+        helper.data->count = helper.cursor->byteOffset / (3 * PropertyTable[helper.data->t].stride);
+        helper.data->list_sizes.clear();
+        helper.data->list_offsets = Buffer();
+        helper.data->list_offsets_type = Type::INVALID;
+    }
+
+    for (auto & entry : userData) entry.second.rows_read = entry.second.num_rows;
+}
+
+// Bytes per row of an element without lists (0 if it has any, so rows have to be walked)
+uint64_t PlyFile::PlyFileImpl::fixed_row_stride(const PlyElement & element) const
+{
+    uint64_t stride = 0;
+    for (const auto & prop : element.properties)
+    {
+        if (prop.isList) return 0;
+        stride += PropertyTable[prop.propertyType].stride;
+    }
+    return stride;
+}
+
+// Identifies a header by its format and elements, so an index is only applied to the file it was built for
+uint32_t PlyFile::PlyFileImpl::header_hash() const
+{
+    std::ostringstream ss;
+    ss << isBinary << isBigEndian;
+    for (const auto & element : elements)
+    {
+        ss << '\n' << element.name << ' ' << element.size;
+        for (const auto & prop : element.properties) ss << ' ' << prop.name << ' ' << int(prop.propertyType) << ' ' << prop.isList << ' ' << int(prop.listType);
+    }
+    return hash_fnv1a(ss.str());
+}
+
+// Steps over the next `num_rows` rows of an element in a binary payload and returns their size in bytes. With
+// `list_items`, the items of the element's list properties are added to it, one counter per list property.
+template <typename Source>
+uint64_t PlyFile::PlyFileImpl::skip_rows(const PlyElement & element, Source & src, const size_t num_rows, uint64_t * list_items) const
+{
+    if (const uint64_t stride = fixed_row_stride(element))
+    {
+        src.skip(static_cast<size_t>(num_rows * stride));
+        return num_rows * stride;
+    }
+
+    std::vector<PropertyLookup> lookups(element.properties.size());
+    for (size_t pi = 0; pi < lookups.size(); ++pi)
+    {
+        const auto & prop = element.properties[pi];
+        lookups[pi].skip = true;
+        lookups[pi].prop_stride = PropertyTable[prop.propertyType].stride;
+        if (prop.isList) lookups[pi].list_stride = PropertyTable[prop.listType].stride;
+    }
+
+    uint32_t list_size = 0;
+    size_t dummy_count = 0;
+    uint64_t bytes = 0;
+    for (size_t row = 0; row < num_rows; ++row)
+    {
+        for (size_t pi = 0, li = 0; pi < lookups.size(); ++pi)
+        {
+            const auto & prop = element.properties[pi];
+            bytes += lookups[pi].list_stride + (isBigEndian ?
+                io::property_io<true, true>::skip(lookups[pi], prop, src, list_size, dummy_count, 1) :
+                io::property_io<true, false>::skip(lookups[pi], prop, src, list_size, dummy_count, 1));
+            if (prop.isList && list_items) list_items[li++] += list_size;
+        }
+    }
+    return bytes;
+}
+
+// `seek(offset)` returns a source positioned at that offset from the start of the file
+template <typename Seek>
+ElementIndex PlyFile::PlyFileImpl::index_elements(const uint64_t payload_offset, const uint64_t interval, Seek seek) const
+{
+    if (!isBinary) throw std::invalid_argument("only binary ply files can be indexed");
+    if (interval == 0) throw std::invalid_argument("`interval` must be at least one row");
+
+    ElementIndex index;
+    index.interval = interval;
+    index.header_hash = header_hash();
+    uint64_t offset = payload_offset;
+    for (const auto & element : elements)
+    {
+        ElementIndex::Entry entry;
+        entry.offset = offset;
+        entry.row_stride = fixed_row_stride(element);
+        if (entry.row_stride) offset += element.size * entry.row_stride;
+        else
+        {
+            std::vector<uint64_t> items(static_cast<size_t>(std::count_if(element.properties.begin(), element.properties.end(),
+                [](const PlyProperty & p) { return p.isList; })), 0);
+            auto src = seek(offset);
+            for (size_t row = 0; row < element.size; row += static_cast<size_t>(interval))
+            {
+                entry.checkpoints.push_back(offset);
+                entry.list_items.insert(entry.list_items.end(), items.begin(), items.end());
+                offset += skip_rows(element, src, static_cast<size_t>((std::min)(interval, static_cast<uint64_t>(element.size - row))), items.data());
             }
+            entry.list_items.insert(entry.list_items.end(), items.begin(), items.end());
         }
+        index.elements.push_back(std::move(entry));
     }
+    return index;
+}
 
-    // Count the number of properties (required for allocation)
-    // e.g. if we have properties x y and z requested, we ensure
-    // that their buffer points to the same PlyData
-    std::unordered_map<PlyData*, int32_t> unique_data_count;
-    for (auto & ptr : buffers) unique_data_count[ptr.get()] += 1;
-
-    // Since group-requested properties share the same cursor,
-    // we need to find unique cursors so we only allocate once
-    std::sort(buffers.begin(), buffers.end());
-    buffers.erase(std::unique(buffers.begin(), buffers.end()), buffers.end());
+// Sets the size of every variable-length list buffer from `ReadOptions::element_index`, which has to describe this
+// file. Triangulated lists produce a different number of items and keep growing; `all_sized` is false if any does.
+void PlyFile::PlyFileImpl::size_lists_from_index(bool & all_sized)
+{
+    all_sized = false;
+    const ElementIndex * index = read_options.element_index.get();
+    if (!index) return;
+    if (index->elements.size() != elements.size() || index->header_hash != header_hash()) throw std::invalid_argument("the element index does not match the header");
 
-    // Allocate buffers based on property type:
-    // - Non-list properties: deterministic size (count * stride * num_properties)
-    // - List properties with hint: computed from hint
-    // - List properties without hint: computed from first pass
-    for (auto & b : buffers)
+    all_sized = true;
+    for (size_t ei = 0; ei < elements.size(); ++ei)
     {
-        for (auto & entry : userData)
+        const auto & element = elements[ei];
+        const auto & entry = index->elements[ei];
+        const size_t num_lists = static_cast<size_t>(std::count_if(element.properties.begin(), element.properties.end(), [](const PlyProperty & p) { return p.isList; }));
+        for (size_t pi = 0, li = 0; pi < element.properties.size(); ++pi)
         {
-            if (entry.second.data == b && b->buffer.get() == nullptr)
-            {
-                if (entry.second.data->isList)
-                {
-                    if (entry.second.list_size_hint > 0)
-                    {
-                        // List with hint: compute size from hint
-                        auto bytes_per_property = entry.second.data->count * PropertyTable[entry.second.data->t].stride * entry.second.list_size_hint;
-                        bytes_per_property *= unique_data_count[b.get()];
-                        b->buffer = Buffer(bytes_per_property);
-                    }
-                    else
-                    {
-                        // List without hint: use first pass result
-                        b->buffer = Buffer(entry.second.cursor->totalSizeBytes);
-                    }
-                }
-                else
-                {
-                    // Non-list: deterministic size, no hint or first pass needed
-                    auto bytes_per_property = entry.second.data->count * PropertyTable[entry.second.data->t].stride;
-                    bytes_per_property *= unique_data_count[b.get()];
-                    b->buffer = Buffer(bytes_per_property);
-                }
-            }
+            const auto & prop = element.properties[pi];
+            if (!prop.isList) continue;
+            const size_t list_index = li++;
+            auto it = userData.find(hash_fnv1a(element.name + prop.name));
+            if (it == userData.end() || it->second.list_size_hint) continue;
+            auto & helper = it->second;
+            if (helper.triangulate || entry.list_items.size() < num_lists) { all_sized = false; continue; }
+            const uint64_t items = entry.list_items[entry.list_items.size() - num_lists + list_index];
+            helper.cursor->totalSizeBytes = static_cast<size_t>(items) * PropertyTable[prop.propertyType].stride;
+            helper.data->buffer = Buffer();
         }
     }
+}
+
+// Reads a row range by parsing as if the header only declared those rows of the element: the other elements and
+// the requests on them are set aside for the duration of the read.
+template <typename Seek>
+void PlyFile::PlyFileImpl::read_rows(const ElementIndex & index, const std::string & elementKey, const size_t begin, const size_t end, Seek seek)
+{
+    if (!isBinary) throw std::invalid_argument("row ranges can only be read from binary ply files");
+    const int64_t element_index = find_element(elementKey, elements);
+    if (element_index < 0) throw std::invalid_argument("the element was not found in the header: " + elementKey);
+    if (index.elements.size() != elements.size() || index.interval == 0 || index.header_hash != header_hash()) throw std::invalid_argument("the element index does not match the header");
+    const PlyElement & element = elements[element_index];
+    if (begin > end || end > element.size) throw std::invalid_argument("row range [" + std::to_string(begin) + ", " + std::to_string(end) + ") exceeds the element");
+
+    // Seek to the closest indexed row at or before `begin` and step over the rest
+    const auto & entry = index.elements[element_index];
+    uint64_t offset = entry.offset + begin * entry.row_stride;
+    if (!entry.row_stride && begin < end)
+    {
+        const size_t checkpoint = static_cast<size_t>(begin / index.interval);
+        if (checkpoint >= entry.checkpoints.size()) throw std::invalid_argument("the element index does not match the header");
+        auto src = seek(entry.checkpoints[checkpoint]);
+        offset = entry.checkpoints[checkpoint] + skip_rows(element, src, static_cast<size_t>(begin - checkpoint * index.interval));
+    }
 
-    // Populate the data
-    parse_data(is, false);
+    std::unordered_map<uint32_t, ParsingHelper> others;
+    std::vector<PlyElement> header = { element };
+    header.front().size = end - begin;
+    std::swap(header, elements);
 
-    // In-place big-endian to little-endian swapping if required
-    if (isBigEndian)
+    // The index describes whole elements, so a range sizes its lists by growing them
+    std::shared_ptr<const ElementIndex> element_index_option;
+    std::swap(element_index_option, read_options.element_index);
+
+    auto restore = [&]()
     {
-        for (auto & b : buffers)
-        {
-            uint8_t * data_ptr = b->buffer.get();
-            const size_t stride = PropertyTable[b->t].stride;
-            const size_t buffer_size_bytes = b->buffer.size_bytes();
+        std::swap(element_index_option, read_options.element_index);
+        std::swap(header, elements);
+        for (auto & request : userData) request.second.num_rows = elements[element_index].size;
+        for (auto & other : others) userData.insert(std::move(other));
+        parsing_state_cached = false;
+    };
 
-            switch (b->t)
-            {
-            case Type::INT16:   endian_swap_buffer<int16_t, int16_t>(data_ptr, buffer_size_bytes, stride);   break;
-            case Type::UINT16:  endian_swap_buffer<uint16_t, uint16_t>(data_ptr, buffer_size_bytes, stride); break;
-            case Type::INT32:   endian_swap_buffer<int32_t, int32_t>(data_ptr, buffer_size_bytes, stride);   break;
-            case Type::UINT32:  endian_swap_buffer<uint32_t, uint32_t>(data_ptr, buffer_size_bytes, stride); break;
-            case Type::FLOAT32: endian_swap_buffer<uint32_t, float>(data_ptr, buffer_size_bytes, stride);    break;
-            case Type::FLOAT64: endian_swap_buffer<uint64_t, double>(data_ptr, buffer_size_bytes, stride);   break;
-            default: break;
-            }
+    try
+    {
+        std::vector<uint32_t> keys;
+        for (const auto & prop : element.properties) keys.push_back(hash_fnv1a(element.name + prop.name));
+        for (auto it = userData.begin(); it != userData.end(); )
+        {
+            if (std::find(keys.begin(), keys.end(), it->first) != keys.end()) { ++it; continue; }
+            others.insert(std::move(*it));
+            it = userData.erase(it);
         }
+        for (auto & request : userData) request.second.num_rows = end - begin;
+
+        auto src = seek(offset);
+        read_impl(src);
+    }
+    catch (...)
+    {
+        restore();
+        throw;
     }
+    restore();
 }
 
 void PlyFile::PlyFileImpl::write(std::ostream & os, bool binary)
 {
-    for (auto & d : userData) { d.second.cursor->byteOffset = 0; }
+    for (auto & d : userData)
+    {
+        if (d.second.data->stride) throw std::invalid_argument("zero-copy views cannot be written; copy them into a tightly-packed buffer first");
+        d.second.cursor->byteOffset = 0;
+    }
     if (binary)
     {
         isBinary = true;
@@ -931,12 +3056,14 @@ void PlyFile::PlyFileImpl::write_binary_internal(std::ostream & os) noexcept
                 {
                     // Determine actual list count for this row:
                     // 1. If p.listCount is set (from add_properties_to_element), use it
-                    // 2. Else if list_sizes is populated (variable-length), use per-row count
+                    // 2. Else if list_offsets or list_sizes is populated (variable-length), use per-row count
                     // 3. Else calculate from buffer size (fixed-length lists from parsing)
                     size_t list_count = p.listCount;
                     if (list_count == 0)
                     {
-                        if (!helper->data->list_sizes.empty())
+                        if (helper->data->list_offsets_type != Type::INVALID)
+                            list_count = helper->data->list_offset(i + 1) - helper->data->list_offset(i);
+                        else if (!helper->data->list_sizes.empty())
                             list_count = helper->data->list_sizes[i];
                         else if (helper->data->count > 0 && f.prop_stride > 0)
                             list_count = helper->data->buffer.size_bytes() / (helper->data->count * f.prop_stride);
@@ -981,7 +3108,9 @@ void PlyFile::PlyFileImpl::write_ascii_internal(std::ostream & os) noexcept
                     size_t list_count = p.listCount;
                     if (list_count == 0)
                     {
-                        if (!helper->data->list_sizes.empty())
+                        if (helper->data->list_offsets_type != Type::INVALID)
+                            list_count = helper->data->list_offset(i + 1) - helper->data->list_offset(i);
+                        else if (!helper->data->list_sizes.empty())
                             list_count = helper->data->list_sizes[i];
                         else if (helper->data->count > 0 && f.prop_stride > 0)
                             list_count = helper->data->buffer.size_bytes() / (helper->data->count * f.prop_stride);
@@ -1047,7 +3176,8 @@ void PlyFile::PlyFileImpl::write_header(std::ostream & os) noexcept
 
 std::shared_ptr<PlyData> PlyFile::PlyFileImpl::request_properties_from_element(const std::string & elementKey,
     const std::vector<std::string> propertyKeys,
-    const uint32_t list_size_hint)
+    const uint32_t list_size_hint,
+    const RequestOptions & options)
 {
     if (elements.empty()) throw std::runtime_error("header had no elements defined. malformed file?");
     if (elementKey.empty()) throw std::invalid_argument("`elementKey` argument is empty");
@@ -1078,7 +3208,15 @@ std::shared_ptr<PlyData> PlyFile::PlyFileImpl::request_properties_from_element(c
         helper.data->isList = false;
         helper.data->t = Type::INVALID;
         helper.cursor = std::make_shared<PlyDataCursor>();
-        helper.list_size_hint = list_size_hint;
+        helper.auto_list_size = list_size_hint == auto_list_size_hint;
+        helper.list_size_hint = helper.auto_list_size ? 0 : list_size_hint;
+        helper.zero_copy = options.zero_copy;
+        helper.list_offsets = options.list_offsets;
+        helper.triangulate = options.triangulate || options.tristrips;
+        helper.tristrips = options.tristrips;
+        helper.face_map = helper.triangulate && options.face_map;
+        helper.num_rows = element.size;
+        if (helper.face_map && element.size > 0xffffffffu) throw std::invalid_argument("face_map requires fewer than 2^32 rows");
 
         // Find each of the keys
         for (const auto & key : propertyKeys)
@@ -1171,22 +3309,16 @@ void PlyFile::PlyFileImpl::add_properties_to_element(const std::string & element
     }
 }
 
-template <bool is_binary, bool first_pass, bool big_endian>
-void PlyFile::PlyFileImpl::parse_data_impl(std::istream & is)
+template <bool is_binary, bool first_pass, bool big_endian, typename Source>
+void PlyFile::PlyFileImpl::parse_data_impl(Source & src)
 {
-    using io = io::property_io<is_binary, big_endian>;
-
-    const auto file_start = is.tellg();
-    uint32_t list_size = 0;
-    size_t dummy_count = 0;
-
     // Use cached parsing state (computed once, reused between passes)
     ensure_parsing_state_cached();
     const auto & element_prop_lut = cached_property_lut;
     const auto & element_batches = cached_batches;
     const auto & element_layouts = cached_layouts;
 
-    // Reusable bulk buffer for bulk read path
+    // Reusable staging buffer for the bulk read path, bounded by read_options.staging_bytes
     std::vector<uint8_t> bulk_buffer;
 
     size_t element_idx = 0;
@@ -1196,111 +3328,476 @@ void PlyFile::PlyFileImpl::parse_data_impl(std::istream & is)
         const auto & batches = element_batches[element_idx];
         const auto & layout = element_layouts[element_idx];
 
+        // Zero-copy views alias this element's rows directly in the in-memory source
+        if constexpr (is_binary && !first_pass && std::is_same<Source, tinyply::io::span_source>::value)
+        {
+            if (!layout.views.empty())
+            {
+                if (element.size * layout.row_stride > static_cast<size_t>(src.end - src.cursor))
+                    throw std::runtime_error("failed to read binary data (unexpected EOF or stream error)");
+
+                for (const auto & view : layout.views)
+                {
+                    const size_t extent = element.size ? (element.size - 1) * layout.row_stride + view.row_bytes : 0;
+                    view.data->buffer = Buffer(src.cursor + view.row_offset, extent, source_owner);
+                }
+            }
+        }
+
+        // Nothing requested from a fixed-size element: step over it in one go (ascii: one token scan)
+        if (layout.skip_element)
+        {
+            if constexpr (is_binary) src.skip(element.size * layout.row_stride);
+            else if (!src.skip_tokens(element.size * element.properties.size())) throw std::runtime_error("failed to skip ascii property value");
+            ++element_idx;
+            continue;
+        }
+
         // Binary second pass optimization: bulk read + AoS->SoA scatter
-        // Enabled when all properties are requested AND layout is fixed (no variable-length lists)
+        // Enabled when the layout is fixed (no variable-length lists); only requested columns are gathered
         if constexpr (is_binary && !first_pass)
         {
             if (layout.fast_path_eligible && element.size > 0)
             {
                 const size_t total_bytes = element.size * layout.row_stride;
 
-                // Bulk read entire element into staging buffer
-                bulk_buffer.resize(total_bytes);
-                fast_read(is, reinterpret_cast<char*>(bulk_buffer.data()), total_bytes);
-
-                // AoS->SoA scatter: distribute properties to their respective cursor buffers
-                for (size_t row = 0; row < element.size; ++row)
+                // The element is byte-identical to its destination: read straight into it, no staging or scatter.
+                // Big-endian data is read in cache-sized pieces that are swapped right away.
+                if (layout.direct_read)
                 {
-                    const uint8_t* row_ptr = bulk_buffer.data() + (row * layout.row_stride);
-
-                    for (size_t pi = 0; pi < lookups.size(); ++pi)
+                    auto * helper = lookups.front().helper;
+                    uint8_t * dst = helper->data->buffer.get() + helper->cursor->byteOffset;
+                    if constexpr (big_endian)
                     {
-                        const auto & lookup = lookups[pi];
-                        auto * helper = lookup.helper;
-                        const auto & prop = element.properties[pi];
-                        const size_t prop_offset = layout.property_offsets[pi];
-
-                        if (prop.isList)
-                        {
-                            uint32_t actual_count = 0;
-                            std::memcpy(&actual_count, row_ptr + prop_offset, lookup.list_stride); // LE only
-                            uint32_t expected = prop.listCount ? static_cast<uint32_t>(prop.listCount) : helper->list_size_hint;
-                            validate_list_hint(actual_count, expected);
-                            size_t data_size = lookup.prop_stride * actual_count;
-                            std::memcpy(helper->data->buffer.get() + helper->cursor->byteOffset, row_ptr + prop_offset + lookup.list_stride, data_size);
-                            helper->cursor->byteOffset += data_size;
-                        }
-                        else
+                        const size_t item_stride = lookups.front().prop_stride;
+                        const size_t piece_bytes = (std::max)(size_t(1), (size_t(256) << 10) / item_stride) * item_stride;
+                        for (size_t offset = 0; offset < total_bytes; offset += piece_bytes)
                         {
-                            std::memcpy(helper->data->buffer.get() + helper->cursor->byteOffset, row_ptr + prop_offset, layout.property_sizes[pi]);
-                            helper->cursor->byteOffset += layout.property_sizes[pi];
+                            const size_t bytes = (std::min)(piece_bytes, total_bytes - offset);
+                            src.read(dst + offset, bytes);
+                            endian_swap_buffer(dst + offset, bytes, item_stride);
                         }
                     }
+                    else src.read(dst, total_bytes);
+                    helper->cursor->byteOffset += total_bytes;
+                    ++element_idx;
+                    continue;
                 }
 
+                scatter_element(element, lookups, layout, element.size, src, bulk_buffer);
                 ++element_idx;
                 continue;
             }
         }
 
-        // slow row-by-row lookup (required: ascii, first pass, or variable-length lists)
-        for (size_t row = 0; row < element.size; ++row)
+        // Auto-sized lists of an in-memory element may be bulk-read up to the first row that breaks the pattern
+        size_t first_row = 0;
+        if constexpr (is_binary && !first_pass && std::is_same<Source, tinyply::io::span_source>::value)
         {
-            for (const auto & batch : batches)
+            if (!lists_counted) first_row = speculate_list_sizes<big_endian>(element, lookups, batches, src, bulk_buffer);
+        }
+
+        // Large in-memory ascii elements are tokenized in parallel line chunks
+        if constexpr (!is_binary && !first_pass)
+        {
+            if (!src.is && parse_ascii_parallel(element, lookups, batches, src))
             {
-                const size_t batch_idx = batch.first;
-                const size_t batch_size = batch.second;
+                ++element_idx;
+                continue;
+            }
+        }
+
+        // slow row-by-row lookup (required: ascii, first pass, or variable-length lists)
+        parse_rows<is_binary, first_pass, big_endian>(element, lookups, batches, src, first_row, element.size);
+
+        ++element_idx;
+    }
+
+    // rewind after first pass
+    if constexpr (first_pass) src.rewind();
+}
+
+// Reads (or in the first pass, measures) rows [first_row, end_row) of an element property by property
+template <bool is_binary, bool first_pass, bool big_endian, typename Source>
+void PlyFile::PlyFileImpl::parse_rows(const PlyElement & element, const std::vector<PropertyLookup> & lookups,
+    const std::vector<std::pair<size_t, size_t>> & batches, Source & src, const size_t first_row, const size_t end_row)
+{
+    using io = io::property_io<is_binary, big_endian>;
+
+    uint32_t list_size = 0;
+    size_t dummy_count = 0;
+
+    // Ascii values of skipped properties are only counted here and stepped over in one token scan right before
+    // the next value that is needed, so the tail of one row and the head of the next are skipped together
+    size_t skipped_tokens = 0;
+    auto skip_pending = [&]()
+    {
+        if constexpr (!is_binary)
+        {
+            if (skipped_tokens && !src.skip_tokens(skipped_tokens)) throw std::runtime_error("failed to skip ascii property value");
+            skipped_tokens = 0;
+        }
+    };
+
+    for (size_t row = first_row; row < end_row; ++row)
+    {
+        for (const auto & batch : batches)
+        {
+            const size_t batch_idx = batch.first;
+            const size_t batch_size = batch.second;
 
-                PlyProperty & prop = element.properties[batch_idx];
-                const auto & lookup = lookups[batch_idx];
+            const PlyProperty & prop = element.properties[batch_idx];
+            const auto & lookup = lookups[batch_idx];
 
-                if (!lookup.skip)
+            if constexpr (!is_binary)
+            {
+                if (lookup.skip && !prop.isList)
                 {
-                    auto * helper = lookup.helper;
-                    if constexpr (first_pass)
-                    {
-                        helper->cursor->totalSizeBytes += io::skip(lookup, prop, is, list_size, dummy_count, batch_size);
-                        if (prop.isList) helper->temp_list_sizes.push_back(list_size);
-                    }
-                    else
-                    {
-                        io::read(lookup, prop, helper->data->buffer.get(), helper->cursor->byteOffset, is, list_size, dummy_count, batch_size);
-                    }
+                    skipped_tokens += batch_size;
+                    continue;
+                }
+                skip_pending();
+            }
+
+            if (!lookup.skip)
+            {
+                auto * helper = lookup.helper;
+                if constexpr (first_pass)
+                {
+                    helper->cursor->totalSizeBytes += io::skip(lookup, prop, src, list_size, dummy_count, batch_size);
+                    if (prop.isList) helper->record_lists(1, list_size);
                 }
                 else
                 {
-                    io::skip(lookup, prop, is, list_size, dummy_count, batch_size);
+                    const size_t bytes = io::read(lookup, prop, helper->data->buffer.get(), helper->cursor->byteOffset, src, list_size, dummy_count, batch_size);
+                    if (prop.isList && helper->face_map) helper->data->triangle_faces.insert(helper->data->triangle_faces.end(), bytes / (3 * lookup.prop_stride), static_cast<uint32_t>(row));
+                    if (prop.isList && !helper->list_size_hint && !lists_counted) helper->append_lists(1, list_size);
                 }
             }
+            else
+            {
+                io::skip(lookup, prop, src, list_size, dummy_count, batch_size);
+            }
         }
+    }
+    skip_pending();
+}
 
-        ++element_idx;
+// Splits the rest of an in-memory ascii payload into chunks of whole lines and parses the element's rows chunk by
+// chunk in parallel. Rows of fixed size are written straight into place; variable-length lists are parsed into
+// buffers of their chunk and appended in order afterwards. This assumes one row per line, which each chunk checks
+// by consuming exactly its tokens: if not (or if the element is too small to be worth it), nothing is consumed
+// and false is returned, leaving the element to the serial parser.
+bool PlyFile::PlyFileImpl::parse_ascii_parallel(const PlyElement & element, const std::vector<PropertyLookup> & lookups,
+    const std::vector<std::pair<size_t, size_t>> & batches, io::ascii_source & src)
+{
+    static const size_t chunk_bytes = size_t(1) << 20;
+    const size_t num_tasks = parallel_task_count(static_cast<size_t>(src.end - src.cursor));
+    if (num_tasks < 2 || element.size < 2) return false;
+    if (std::all_of(lookups.begin(), lookups.end(), [](const PropertyLookup & l) { return l.skip; })) return false; // skipping is a scan already
+
+    // Runs `job` for [0, count) on `num_tasks` tasks that take the next index until none are left
+    auto run = [&](const size_t count, const std::function<void(size_t)> & job)
+    {
+        std::atomic<size_t> next{ 0 };
+        parallel_for((std::min)(num_tasks, count), [&](size_t) { for (size_t i = next++; i < count; i = next++) job(i); });
+    };
+
+    // Line chunks are counted in growing batches until they cover the element
+    struct LineChunk { const char * begin; const char * end; size_t first_row; size_t rows; };
+    std::vector<LineChunk> chunks;
+    size_t rows = 0;
+    for (size_t batch = num_tasks; rows < element.size && src.end != (chunks.empty() ? src.cursor : chunks.back().end); batch *= 2)
+    {
+        const size_t batch_begin = chunks.size();
+        const char * pos = chunks.empty() ? src.cursor : chunks.back().end;
+        for (size_t i = 0; i < batch && pos != src.end; ++i)
+        {
+            const char * end = static_cast<size_t>(src.end - pos) > chunk_bytes ? io::line_end(pos + chunk_bytes, src.end) : src.end;
+            chunks.push_back({ pos, end, 0, 0 });
+            pos = end;
+        }
+        run(chunks.size() - batch_begin, [&](size_t i)
+        {
+            auto & chunk = chunks[batch_begin + i];
+            io::scan_ascii_rows(chunk.begin, chunk.end, chunk.rows, SIZE_MAX);
+        });
+        for (size_t i = batch_begin; i < chunks.size(); ++i)
+        {
+            auto & chunk = chunks[i];
+            chunk.first_row = rows;
+            if (rows + chunk.rows >= element.size)
+            {
+                // The element ends within this chunk
+                chunk.rows = 0;
+                chunk.end = io::scan_ascii_rows(chunk.begin, chunk.end, chunk.rows, element.size - rows);
+                chunks.resize(i + 1);
+            }
+            rows += chunk.rows;
+        }
     }
+    if (rows != element.size || chunks.size() < 2) return false;
 
-    // rewind after first pass
-    if constexpr (first_pass) is.seekg(file_start, is.beg);
+    // Each group (the properties that share a cursor) gets a stand-in helper per chunk, remapped in a copy of the lookups
+    std::vector<ParsingHelper *> groups;
+    std::vector<size_t> row_bytes; // fixed-size groups: bytes per row (0 for variable-length lists)
+    std::vector<size_t> group_of(lookups.size(), SIZE_MAX);
+    for (const auto & batch : batches)
+    {
+        const auto & lookup = lookups[batch.first];
+        if (lookup.skip) continue;
+        auto * helper = lookup.helper;
+        const size_t g = std::find_if(groups.begin(), groups.end(), [&](const ParsingHelper * group) { return group->cursor == helper->cursor; }) - groups.begin();
+        if (g == groups.size())
+        {
+            groups.push_back(helper);
+            row_bytes.push_back(0);
+        }
+        group_of[batch.first] = g;
+        if (!helper->data->isList) row_bytes[g] += lookup.prop_stride * batch.second;
+        else if (helper->list_size_hint && !helper->triangulate) row_bytes[g] += lookup.prop_stride * helper->list_size_hint;
+    }
+    for (size_t g = 0; g < groups.size(); ++g)
+    {
+        if (row_bytes[g] && groups[g]->cursor->byteOffset + element.size * row_bytes[g] > groups[g]->data->buffer.size_bytes()) return false;
+    }
+
+    struct ChunkState
+    {
+        std::vector<ParsingHelper> helpers;
+        bool parsed{ false };
+    };
+    std::vector<ChunkState> states(chunks.size());
+    run(chunks.size(), [&](size_t c)
+    {
+        const auto & chunk = chunks[c];
+        auto & helpers = states[c].helpers;
+        helpers.resize(groups.size());
+        for (size_t g = 0; g < groups.size(); ++g)
+        {
+            const ParsingHelper & group = *groups[g];
+            ParsingHelper & helper = helpers[g];
+            helper.data = std::make_shared<PlyData>();
+            helper.data->t = group.data->t;
+            helper.data->isList = group.data->isList;
+            helper.data->count = chunk.rows;
+            helper.cursor = std::make_shared<PlyDataCursor>();
+            helper.list_size_hint = group.list_size_hint;
+            helper.auto_list_size = group.auto_list_size;
+            helper.list_offsets = group.list_offsets;
+            helper.triangulate = group.triangulate;
+            helper.tristrips = group.tristrips;
+            helper.face_map = group.face_map;
+            helper.num_rows = chunk.rows;
+            if (row_bytes[g])
+            {
+                uint8_t * rows_dest = group.data->buffer.get() + group.cursor->byteOffset + chunk.first_row * row_bytes[g];
+                helper.data->buffer = Buffer(rows_dest, chunk.rows * row_bytes[g], nullptr);
+            }
+        }
+        std::vector<PropertyLookup> chunk_lookups = lookups;
+        for (size_t i = 0; i < chunk_lookups.size(); ++i)
+        {
+            if (group_of[i] != SIZE_MAX) chunk_lookups[i].helper = &helpers[group_of[i]];
+        }
+
+        io::ascii_source chunk_src(reinterpret_cast<const uint8_t *>(chunk.begin), static_cast<size_t>(chunk.end - chunk.begin));
+        try
+        {
+            parse_rows<false, false, false>(element, chunk_lookups, batches, chunk_src, chunk.first_row, chunk.first_row + chunk.rows);
+            states[c].parsed = chunk_src.token() == chunk_src.end;
+        }
+        catch (...) {} // the serial parser reports any error where it occurs
+    });
+    for (const auto & state : states)
+    {
+        if (!state.parsed) return false;
+    }
+
+    // Append the variable-length lists of the chunks in order
+    for (size_t g = 0; g < groups.size(); ++g)
+    {
+        ParsingHelper & group = *groups[g];
+        if (row_bytes[g])
+        {
+            group.cursor->byteOffset += element.size * row_bytes[g];
+            continue;
+        }
+        std::vector<size_t> offsets(states.size() + 1, group.cursor->byteOffset);
+        for (size_t c = 0; c < states.size(); ++c) offsets[c + 1] = offsets[c] + states[c].helpers[g].cursor->byteOffset;
+        if (offsets.back() > group.data->buffer.size_bytes()) grow_list_buffer(group, offsets.back());
+        uint8_t * dest = group.data->buffer.get();
+        run(states.size(), [&](size_t c)
+        {
+            if (offsets[c + 1] > offsets[c]) std::memcpy(dest + offsets[c], states[c].helpers[g].data->buffer.get(), offsets[c + 1] - offsets[c]);
+        });
+        group.cursor->byteOffset = offsets.back();
+        for (auto & state : states)
+        {
+            const ParsingHelper & helper = state.helpers[g];
+            if (!group.list_size_hint && !lists_counted) group.append_lists(helper);
+            if (group.face_map) group.data->triangle_faces.insert(group.data->triangle_faces.end(), helper.data->triangle_faces.begin(), helper.data->triangle_faces.end());
+        }
+    }
+
+    src.cursor = chunks.back().end;
+    return true;
 }
 
-void PlyFile::PlyFileImpl::parse_data(std::istream & is, bool first_pass)
+// AoS->SoA scatter of the next `num_rows` rows of a fast-path element: distribute properties to their respective
+// cursor buffers. Rows are independent, so large chunks are split into row ranges scattered in parallel.
+template <typename Source>
+void PlyFile::PlyFileImpl::scatter_element(const PlyElement & element, const std::vector<PropertyLookup> & lookups,
+    const ElementLayoutInfo & layout, const size_t num_rows, Source & src, std::vector<uint8_t> & staging)
 {
-    if (isBinary)
+    const auto columns = plan_scatter(element, lookups, layout, num_rows);
+
+    // Every row of a fixed-size polygon list yields the same number of triangles
+    for (size_t pi = 0; pi < lookups.size(); ++pi)
+    {
+        ParsingHelper * helper = lookups[pi].helper;
+        if (lookups[pi].skip || !helper->face_map || !element.properties[pi].isList) continue;
+        const size_t triangles = (layout.property_sizes[pi] - lookups[pi].list_stride) / lookups[pi].prop_stride - 2;
+        auto & faces = helper->data->triangle_faces;
+        faces.reserve(faces.size() + num_rows * triangles);
+        for (size_t row = 0; row < num_rows; ++row) faces.insert(faces.end(), triangles, static_cast<uint32_t>(row));
+    }
+
+    // Stream sources stage a bounded chunk of rows at a time; in-memory sources are viewed in place
+    const size_t chunk_rows = std::is_same<Source, io::span_source>::value ? num_rows :
+        (std::max)(size_t(1), read_options.staging_bytes / layout.row_stride);
+
+    for (size_t first_row = 0; first_row < num_rows; first_row += chunk_rows)
+    {
+        const size_t chunk = (std::min)(chunk_rows, num_rows - first_row);
+        const uint8_t * rows = src.view(chunk * layout.row_stride, staging);
+        const size_t num_tasks = parallel_task_count(chunk * layout.row_stride);
+        parallel_for(num_tasks, [&](size_t task)
+        {
+            scatter_rows(rows, layout.row_stride, first_row, first_row + chunk * task / num_tasks,
+                first_row + chunk * (task + 1) / num_tasks, columns);
+        });
+    }
+}
+
+// Speculates that the auto-sized lists of a binary in-memory element keep the sizes of its leading rows. If a
+// sample of rows agrees, the element is laid out as if those sizes had been hinted and rows are bulk-scattered
+// up to the first one whose counts differ. Returns the number of rows consumed (0 if nothing was speculated);
+// the row-by-row path picks up from there, still counting rows against the sampled sizes.
+template <bool big_endian>
+size_t PlyFile::PlyFileImpl::speculate_list_sizes(const PlyElement & element, const std::vector<PropertyLookup> & lookups,
+    const std::vector<std::pair<size_t, size_t>> & batches, io::span_source & src, std::vector<uint8_t> & staging)
+{
+    std::vector<size_t> auto_lists;
+    for (size_t pi = 0; pi < lookups.size(); ++pi)
+    {
+        if (lookups[pi].helper && lookups[pi].helper->auto_list_size && element.properties[pi].isList) auto_lists.push_back(pi);
+    }
+    if (auto_lists.empty() || element.size == 0) return 0;
+
+    // Sample the leading rows through a copy of the source
+    std::vector<uint32_t> sizes(lookups.size(), 0);
+    io::span_source probe = src;
+    uint32_t list_size = 0;
+    size_t dummy_count = 0;
+    const size_t sample_rows = (std::min)(element.size, size_t(256));
+    for (size_t row = 0; row < sample_rows; ++row)
+    {
+        for (const auto & batch : batches)
+        {
+            io::property_io<true, big_endian>::skip(lookups[batch.first], element.properties[batch.first], probe, list_size, dummy_count, batch.second);
+            if (!element.properties[batch.first].isList || !lookups[batch.first].helper || !lookups[batch.first].helper->auto_list_size) continue;
+            if (row == 0) sizes[batch.first] = list_size;
+            else if (sizes[batch.first] != list_size) return 0;
+        }
+    }
+
+    for (size_t pi : auto_lists) lookups[pi].helper->list_size_hint = sizes[pi];
+    const ElementLayoutInfo layout = check_fastpath(element, lookups);
+
+    size_t rows = 0;
+    if (layout.fast_path_eligible)
+    {
+        // Rows are addressable up to the first one whose counts differ from the sample
+        std::vector<std::array<uint8_t, 4>> raw(auto_lists.size());
+        bool encodable = true;
+        for (size_t i = 0; i < auto_lists.size(); ++i)
+        {
+            const size_t pi = auto_lists[i];
+            const size_t stride = lookups[pi].list_stride;
+            raw[i] = { 0, 0, 0, 0 };
+            for (size_t k = 0; k < stride; ++k) raw[i][big_endian ? stride - 1 - k : k] = static_cast<uint8_t>(sizes[pi] >> (8 * k));
+            encodable &= decode_list_count(element.properties[pi].listType, raw[i].data(), stride, big_endian) == sizes[pi];
+        }
+
+        const size_t available = static_cast<size_t>(src.end - src.cursor) / layout.row_stride;
+        const size_t limit = encodable ? (std::min)(element.size, available) : 0;
+        for (; rows < limit; ++rows)
+        {
+            const uint8_t * row = src.cursor + rows * layout.row_stride;
+            bool same = true;
+            for (size_t i = 0; i < auto_lists.size(); ++i)
+            {
+                same &= std::memcmp(row + layout.property_offsets[auto_lists[i]], raw[i].data(), lookups[auto_lists[i]].list_stride) == 0;
+            }
+            if (!same) break;
+        }
+
+        if (rows)
+        {
+            // Size the auto-sized groups for the whole element at the sampled sizes
+            std::vector<std::pair<ParsingHelper *, size_t>> groups; // {helper, bytes per row}
+            for (size_t pi = 0; pi < lookups.size(); ++pi)
+            {
+                if (lookups[pi].skip) continue;
+                ParsingHelper * helper = lookups[pi].helper;
+                auto group = std::find_if(groups.begin(), groups.end(), [&](const std::pair<ParsingHelper *, size_t> & g) { return g.first->data == helper->data; });
+                if (group == groups.end()) group = groups.insert(groups.end(), { helper, 0 });
+                group->second += element.properties[pi].isList ? list_payload_bytes(*helper, helper->list_size_hint, lookups[pi].prop_stride) : lookups[pi].prop_stride;
+                if (helper->auto_list_size) group->first = helper;
+            }
+            for (auto & group : groups)
+            {
+                if (!group.first->auto_list_size) continue;
+                const size_t needed = group.first->cursor->byteOffset + element.size * group.second;
+                if (needed > group.first->data->buffer.size_bytes()) grow_list_buffer(*group.first, needed);
+            }
+
+            scatter_element(element, lookups, layout, rows, src, staging);
+        }
+    }
+
+    for (size_t pi : auto_lists)
+    {
+        lookups[pi].helper->list_size_hint = 0;
+        lookups[pi].helper->speculative_list_size = sizes[pi];
+        lookups[pi].helper->speculative_rows = rows;
+    }
+    return rows;
+}
+
+template <typename Source>
+void PlyFile::PlyFileImpl::parse_data(Source & src, bool first_pass)
+{
+    if constexpr (std::is_same<Source, io::ascii_source>::value)
+    {
+        if (first_pass) parse_data_impl<false, true, false>(src);
+        else  parse_data_impl<false, false, false>(src);
+    }
+    else if (isBinary)
     {  
         if (isBigEndian)
         {
-            if (first_pass) parse_data_impl<true, true, true>(is);
-            else parse_data_impl<true, false, true>(is);
+            if (first_pass) parse_data_impl<true, true, true>(src);
+            else parse_data_impl<true, false, true>(src);
         }
         else
         {
-            if (first_pass) parse_data_impl<true, true, false>(is);
-            else parse_data_impl<true, false, false>(is);
+            if (first_pass) parse_data_impl<true, true, false>(src);
+            else parse_data_impl<true, false, false>(src);
         }
     }
-    else
-    {
-        if (first_pass) parse_data_impl<false, true, false>(is);
-        else  parse_data_impl<false, false, false>(is);
-    }
+    else throw std::logic_error("ascii payloads must be parsed through an ascii_source");
 }
 
 // Wrap the public interface:
@@ -1309,17 +3806,159 @@ PlyFile::PlyFile() { impl.reset(new PlyFileImpl()); }
 PlyFile::~PlyFile() { }
 bool PlyFile::parse_header(std::istream & is) { return impl->parse_header(is); }
 void PlyFile::read(std::istream & is) { return impl->read(is); }
+bool PlyFile::parse_header(const uint8_t * data, const size_t size) { return impl->parse_header(data, size); }
+void PlyFile::read(const uint8_t * data, const size_t size) { return impl->read(data, size); }
+bool PlyFile::parse_header_file(const std::string & filepath)
+{
+    const io::mapped_file & file = impl->map_file(filepath);
+    return impl->parse_header(file.data(), file.size());
+}
+void PlyFile::read_file(const std::string & filepath)
+{
+    const io::mapped_file & file = impl->map_file(filepath);
+    return impl->read(file.data(), file.size(), impl->mapped);
+}
+ElementIndex PlyFile::index_elements(std::istream & is, const uint64_t interval)
+{
+    const uint64_t payload_offset = static_cast<uint64_t>(is.tellg());
+    return impl->index_elements(payload_offset, interval, [&](const uint64_t offset)
+    {
+        is.clear();
+        if (!is.seekg(static_cast<std::streamoff>(offset))) throw std::runtime_error("failed to seek to offset " + std::to_string(offset));
+        return io::stream_source(is);
+    });
+}
+ElementIndex PlyFile::index_elements(const uint8_t * data, const size_t size, const uint64_t interval)
+{
+    ElementIndex index = impl->index_elements(io::find_payload_offset(data, size), interval, [&](const uint64_t offset)
+    {
+        if (offset > size) throw std::runtime_error("failed to seek to offset " + std::to_string(offset));
+        return io::span_source(data + offset, size - static_cast<size_t>(offset));
+    });
+    index.file_size = size;
+    return index;
+}
+ElementIndex PlyFile::index_elements_file(const std::string & filepath, const uint64_t interval)
+{
+    std::ifstream is(filepath, std::ios::binary);
+    if (!is) throw std::runtime_error("failed to open file: " + filepath);
+    io::skip_header(is);
+    ElementIndex index = index_elements(is, interval);
+    if (!io::file_stamp(filepath, index.file_size, index.file_mtime)) throw std::runtime_error("failed to query file size: " + filepath);
+    return index;
+}
+void PlyFile::read_rows(std::istream & is, const ElementIndex & index, const std::string & elementKey, const size_t begin, const size_t end)
+{
+    impl->read_rows(index, elementKey, begin, end, [&](const uint64_t offset)
+    {
+        is.clear();
+        if (!is.seekg(static_cast<std::streamoff>(offset))) throw std::runtime_error("failed to seek to offset " + std::to_string(offset));
+        return io::stream_source(is);
+    });
+}
+void PlyFile::read_rows(const uint8_t * data, const size_t size, const ElementIndex & index, const std::string & elementKey, const size_t begin, const size_t end)
+{
+    impl->read_rows(index, elementKey, begin, end, [&](const uint64_t offset)
+    {
+        if (offset > size) throw std::runtime_error("failed to seek to offset " + std::to_string(offset));
+        return io::span_source(data + offset, size - static_cast<size_t>(offset));
+    });
+}
+void PlyFile::read_rows_file(const std::string & filepath, const ElementIndex & index, const std::string & elementKey, const size_t begin, const size_t end)
+{
+    std::ifstream is(filepath, std::ios::binary);
+    if (!is) throw std::runtime_error("failed to open file: " + filepath);
+    read_rows(is, index, elementKey, begin, end);
+}
+void PlyFile::save_index_file(const std::string & indexpath, const ElementIndex & index) const
+{
+    std::ofstream os(indexpath, std::ios::binary);
+    if (!os) throw std::runtime_error("failed to open file: " + indexpath);
+    auto put = [&](const uint64_t value) { os.write(reinterpret_cast<const char *>(&value), sizeof(value)); };
+    auto put_all = [&](const std::vector<uint64_t> & values)
+    {
+        put(values.size());
+        os.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(uint64_t)));
+    };
+
+    os.write("tplyidx1", 8);
+    put(index.file_size);
+    put(static_cast<uint64_t>(index.file_mtime));
+    put(index.header_hash);
+    put(index.interval);
+    put(index.elements.size());
+    for (const auto & entry : index.elements)
+    {
+        put(entry.offset);
+        put(entry.row_stride);
+        put_all(entry.checkpoints);
+        put_all(entry.list_items);
+    }
+    if (!os) throw std::runtime_error("failed to write file: " + indexpath);
+}
+bool PlyFile::load_index_file(const std::string & indexpath, const std::string & filepath, ElementIndex & index) const
+{
+    std::ifstream is(indexpath, std::ios::binary | std::ios::ate);
+    const std::streamoff index_size = is.tellg();
+    char magic[8];
+    if (!is.seekg(0) || !is.read(magic, sizeof(magic)) || std::memcmp(magic, "tplyidx1", sizeof(magic)) != 0) return false;
+    auto get = [&]() { uint64_t value = 0; is.read(reinterpret_cast<char *>(&value), sizeof(value)); return value; };
+
+    ElementIndex loaded;
+    loaded.file_size = get();
+    loaded.file_mtime = static_cast<int64_t>(get());
+    loaded.header_hash = static_cast<uint32_t>(get());
+    loaded.interval = get();
+    const uint64_t num_elements = get();
+
+    // Nothing past the fixed-size fields is trusted until they match the file and header they claim to describe
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    if (!is || !io::file_stamp(filepath, size, mtime)) return false;
+    if (loaded.file_size != size || loaded.file_mtime != mtime || loaded.header_hash != impl->header_hash()) return false;
+    if (loaded.interval == 0 || num_elements != impl->elements.size()) return false;
+
+    // A count is only believed if its values fit in the rest of the sidecar and in the rows of the element
+    auto get_all = [&](std::vector<uint64_t> & values, const uint64_t limit)
+    {
+        const uint64_t count = get();
+        if (!is) return false;
+        const uint64_t remaining = static_cast<uint64_t>(index_size - static_cast<std::streamoff>(is.tellg()));
+        if (count > limit || count > remaining / sizeof(uint64_t)) return false;
+        values.resize(static_cast<size_t>(count));
+        return static_cast<bool>(is.read(reinterpret_cast<char *>(values.data()), static_cast<std::streamsize>(count * sizeof(uint64_t))));
+    };
+
+    loaded.elements.resize(impl->elements.size());
+    for (size_t i = 0; i < loaded.elements.size(); ++i)
+    {
+        const PlyElement & element = impl->elements[i];
+        const uint64_t num_lists = static_cast<uint64_t>(std::count_if(element.properties.begin(), element.properties.end(),
+            [](const PlyProperty & p) { return p.isList; }));
+        auto & entry = loaded.elements[i];
+        entry.offset = get();
+        entry.row_stride = get();
+        if (!get_all(entry.checkpoints, element.size / loaded.interval + 1)) return false;
+        if (!get_all(entry.list_items, num_lists * (entry.checkpoints.size() + 1))) return false;
+    }
+    if (!is) return false;
+
+    index = std::move(loaded);
+    return true;
+}
 void PlyFile::write(std::ostream & os, bool isBinary) { return impl->write(os, isBinary); }
 std::vector<PlyElement> PlyFile::get_elements() const { return impl->elements; }
 std::vector<std::string> & PlyFile::get_comments() { return impl->comments; }
+ReadOptions & PlyFile::get_read_options() { return impl->read_options; }
 std::vector<std::string> PlyFile::get_info() const { return impl->objInfo; }
 bool PlyFile::is_binary_file() const { return impl->isBinary; }
 bool PlyFile::is_big_endian() const { return impl->isBigEndian; }
 std::shared_ptr<PlyData> PlyFile::request_properties_from_element(const std::string & elementKey,
     const std::vector<std::string> propertyKeys,
-    const uint32_t list_size_hint)
+    const uint32_t list_size_hint,
+    const RequestOptions & options)
 {
-    return impl->request_properties_from_element(elementKey, propertyKeys, list_size_hint);
+    return impl->request_properties_from_element(elementKey, propertyKeys, list_size_hint, options);
 }
 void PlyFile::add_properties_to_element(const std::string & elementKey,
     const std::vector<std::string> propertyKeys,